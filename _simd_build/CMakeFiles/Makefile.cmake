@@ -0,0 +1,120 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/SpatialOpsConfig.cmake.in"
+  "/root/repo/SpatialOpsConfigure.h.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/spatialops/CMakeLists.txt"
+  "/root/repo/spatialops/particles/CMakeLists.txt"
+  "/root/repo/spatialops/particles/test/CMakeLists.txt"
+  "/root/repo/spatialops/pointfield/CMakeLists.txt"
+  "/root/repo/spatialops/pointfield/test/CMakeLists.txt"
+  "/root/repo/spatialops/structured/CMakeLists.txt"
+  "/root/repo/spatialops/structured/onedim/CMakeLists.txt"
+  "/root/repo/spatialops/structured/onedim/test/CMakeLists.txt"
+  "/root/repo/spatialops/structured/stencil/CMakeLists.txt"
+  "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt"
+  "/root/repo/spatialops/structured/test/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/heatEqn/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/boost_program_options-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_program_options-1.74.0/libboost_program_options-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "config/spatialops/SpatialOpsConfigure.h"
+  "config/SpatialOpsConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/structured/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/structured/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/structured/onedim/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/structured/onedim/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/structured/stencil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/particles/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/particles/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/pointfield/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "spatialops/pointfield/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/heatEqn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "spatialops/CMakeFiles/spatialops.dir/DependInfo.cmake"
+  "spatialops/structured/CMakeFiles/spatialops-structured.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_field_compare.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_mask.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_field.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_memwindow.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_grid.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_tools.dir/DependInfo.cmake"
+  "spatialops/structured/test/CMakeFiles/test_bc.dir/DependInfo.cmake"
+  "spatialops/structured/onedim/CMakeFiles/spatialops-onedim.dir/DependInfo.cmake"
+  "spatialops/structured/onedim/test/CMakeFiles/lagrange.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/CMakeFiles/spatialops-stencil.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_ref_stencil.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_stencil2.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_stencil4.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_bc_stencil.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_filter.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_chain_stencil.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_chain_stencil_tiled.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_chain_stencil_nested.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_collapse_stencil.dir/DependInfo.cmake"
+  "spatialops/structured/stencil/test/CMakeFiles/test_const_coef_stencil.dir/DependInfo.cmake"
+  "spatialops/particles/test/CMakeFiles/particle_ops.dir/DependInfo.cmake"
+  "spatialops/pointfield/test/CMakeFiles/point_field.dir/DependInfo.cmake"
+  "test/CMakeFiles/field_exprs.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_nebo.dir/DependInfo.cmake"
+  "test/CMakeFiles/fused_assign.dir/DependInfo.cmake"
+  "test/CMakeFiles/reductions.dir/DependInfo.cmake"
+  "test/CMakeFiles/reduction_benchmark.dir/DependInfo.cmake"
+  "test/CMakeFiles/let.dir/DependInfo.cmake"
+  "test/heatEqn/CMakeFiles/heateqn.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,27 @@
+# SpatialOpsConfig.cmake - defines variables to assist in applications
+# that link with SpatialOps
+#
+# The following variables are defined:
+#
+# SpatialOps_FOUND - true (1)
+#
+# SpatialOps_INCLUDE_DIR - include directories for SpatialOps
+#
+# Typical useage:
+#    find_package( SpatialOps )
+#    include_directories( ${SpatialOps_INCLUDE_DIR} )
+#    target_link_libraries( ... spatialops )
+#
+
+set( SpatialOps_INCLUDE_DIR
+  /root/repo/_simd_build/include
+  /usr/include
+  )
+set( Boost_INCLUDE /usr/include )
+set( Boost_LIB Boost::program_options )
+
+set( ENABLE_THREADS OFF )
+set( NTHREADS 1 )
+set( ENABLE_CUDA OFF )
+
+include( /root/repo/_simd_build/lib/spatialops/SpatialOps.cmake )
@@ -0,0 +1,51 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "spatialops-onedim" for configuration "Release"
+set_property(TARGET spatialops-onedim APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(spatialops-onedim PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/spatialops/libspatialops-onedim.a"
+  )
+
+list(APPEND _cmake_import_check_targets spatialops-onedim )
+list(APPEND _cmake_import_check_files_for_spatialops-onedim "${_IMPORT_PREFIX}/lib/spatialops/libspatialops-onedim.a" )
+
+# Import target "spatialops-stencil" for configuration "Release"
+set_property(TARGET spatialops-stencil APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(spatialops-stencil PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/spatialops/libspatialops-stencil.a"
+  )
+
+list(APPEND _cmake_import_check_targets spatialops-stencil )
+list(APPEND _cmake_import_check_files_for_spatialops-stencil "${_IMPORT_PREFIX}/lib/spatialops/libspatialops-stencil.a" )
+
+# Import target "spatialops-structured" for configuration "Release"
+set_property(TARGET spatialops-structured APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(spatialops-structured PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "Boost::program_options;spatialops-onedim;spatialops-stencil"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/spatialops/libspatialops-structured.a"
+  )
+
+list(APPEND _cmake_import_check_targets spatialops-structured )
+list(APPEND _cmake_import_check_files_for_spatialops-structured "${_IMPORT_PREFIX}/lib/spatialops/libspatialops-structured.a" )
+
+# Import target "spatialops" for configuration "Release"
+set_property(TARGET spatialops APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(spatialops PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LINK_INTERFACE_LIBRARIES_RELEASE "Boost::program_options;spatialops-structured"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/spatialops/libspatialops.a"
+  )
+
+list(APPEND _cmake_import_check_targets spatialops )
+list(APPEND _cmake_import_check_files_for_spatialops "${_IMPORT_PREFIX}/lib/spatialops/libspatialops.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
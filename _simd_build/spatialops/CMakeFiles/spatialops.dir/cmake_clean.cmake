@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spatialops.dir/empty.cpp.o"
+  "CMakeFiles/spatialops.dir/empty.cpp.o.d"
+  "libspatialops.a"
+  "libspatialops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spatialops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
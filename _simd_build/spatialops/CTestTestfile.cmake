@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops
+# Build directory: /root/repo/_simd_build/spatialops
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("structured")
+subdirs("particles")
+subdirs("pointfield")
@@ -0,0 +1,108 @@
+# Install script for directory: /root/repo/spatialops
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/root/repo/_simd_build")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/spatialops" TYPE FILE PERMISSIONS OWNER_READ GROUP_READ WORLD_READ FILES
+    "/root/repo/spatialops/Nebo.h"
+    "/root/repo/spatialops/NeboBasic.h"
+    "/root/repo/spatialops/NeboRhs.h"
+    "/root/repo/spatialops/NeboMask.h"
+    "/root/repo/spatialops/NeboOperators.h"
+    "/root/repo/spatialops/NeboCond.h"
+    "/root/repo/spatialops/NeboStencils.h"
+    "/root/repo/spatialops/NeboStencilBuilder.h"
+    "/root/repo/spatialops/NeboStencilConstCoefs.h"
+    "/root/repo/spatialops/NeboLhs.h"
+    "/root/repo/spatialops/NeboAssignment.h"
+    "/root/repo/spatialops/NeboFusedAssignment.h"
+    "/root/repo/spatialops/NeboLet.h"
+    "/root/repo/spatialops/NeboTiling.h"
+    "/root/repo/spatialops/NeboReductions.h"
+    "/root/repo/spatialops/NeboReductionWalk.h"
+    "/root/repo/spatialops/NeboSIMD.h"
+    "/root/repo/spatialops/FieldFunctions.h"
+    "/root/repo/spatialops/OperatorDatabase.h"
+    "/root/repo/spatialops/SpatialOpsDefs.h"
+    "/root/repo/spatialops/SpatialOpsTools.h"
+    "/root/repo/spatialops/WriteMatlab.h"
+    "/root/repo/spatialops/Semaphore.h"
+    "/root/repo/spatialops/CountdownLatch.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/spatialops" TYPE STATIC_LIBRARY PERMISSIONS OWNER_READ GROUP_READ WORLD_READ FILES "/root/repo/_simd_build/spatialops/libspatialops.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/spatialops/SpatialOps.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/spatialops/SpatialOps.cmake"
+         "/root/repo/_simd_build/spatialops/CMakeFiles/Export/ad616257f66b3d8d01b2f53ba15557f9/SpatialOps.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/spatialops/SpatialOps-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/spatialops/SpatialOps.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/spatialops" TYPE FILE FILES "/root/repo/_simd_build/spatialops/CMakeFiles/Export/ad616257f66b3d8d01b2f53ba15557f9/SpatialOps.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/spatialops" TYPE FILE FILES "/root/repo/_simd_build/spatialops/CMakeFiles/Export/ad616257f66b3d8d01b2f53ba15557f9/SpatialOps-release.cmake")
+  endif()
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_simd_build/spatialops/structured/cmake_install.cmake")
+  include("/root/repo/_simd_build/spatialops/particles/cmake_install.cmake")
+  include("/root/repo/_simd_build/spatialops/pointfield/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/spatialops/particles/test/TestParticleOperators.cpp" "spatialops/particles/test/CMakeFiles/particle_ops.dir/TestParticleOperators.cpp.o" "gcc" "spatialops/particles/test/CMakeFiles/particle_ops.dir/TestParticleOperators.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/spatialops/CMakeFiles/spatialops.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/spatialops/structured/CMakeFiles/spatialops-structured.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/spatialops/structured/onedim/CMakeFiles/spatialops-onedim.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/spatialops/structured/stencil/CMakeFiles/spatialops-stencil.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/particle_ops.dir/TestParticleOperators.cpp.o"
+  "CMakeFiles/particle_ops.dir/TestParticleOperators.cpp.o.d"
+  "particle_ops"
+  "particle_ops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/particle_ops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/particles/test
+# Build directory: /root/repo/_simd_build/spatialops/particles/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(particle_ops "particle_ops")
+set_tests_properties(particle_ops PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/particles/test/CMakeLists.txt;5;add_test;/root/repo/spatialops/particles/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/point_field.dir/testPointField.cpp.o"
+  "CMakeFiles/point_field.dir/testPointField.cpp.o.d"
+  "point_field"
+  "point_field.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/point_field.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
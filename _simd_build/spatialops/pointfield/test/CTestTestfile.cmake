@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/pointfield/test
+# Build directory: /root/repo/_simd_build/spatialops/pointfield/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(point_field "point_field")
+set_tests_properties(point_field PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/pointfield/test/CMakeLists.txt;5;add_test;/root/repo/spatialops/pointfield/test/CMakeLists.txt;0;")
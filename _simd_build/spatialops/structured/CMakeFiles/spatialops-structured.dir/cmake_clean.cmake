@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spatialops-structured.dir/GhostData.cpp.o"
+  "CMakeFiles/spatialops-structured.dir/GhostData.cpp.o.d"
+  "CMakeFiles/spatialops-structured.dir/Grid.cpp.o"
+  "CMakeFiles/spatialops-structured.dir/Grid.cpp.o.d"
+  "CMakeFiles/spatialops-structured.dir/MemoryPool.cpp.o"
+  "CMakeFiles/spatialops-structured.dir/MemoryPool.cpp.o.d"
+  "CMakeFiles/spatialops-structured.dir/MemoryWindow.cpp.o"
+  "CMakeFiles/spatialops-structured.dir/MemoryWindow.cpp.o.d"
+  "libspatialops-structured.a"
+  "libspatialops-structured.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spatialops-structured.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
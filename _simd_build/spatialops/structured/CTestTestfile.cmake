@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/structured
+# Build directory: /root/repo/_simd_build/spatialops/structured
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("test")
+subdirs("onedim")
+subdirs("stencil")
@@ -0,0 +1,81 @@
+# Install script for directory: /root/repo/spatialops/structured
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/root/repo/_simd_build")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/spatialops/structured" TYPE FILE PERMISSIONS OWNER_READ GROUP_READ WORLD_READ FILES
+    "/root/repo/spatialops/structured/BoundaryCellInfo.h"
+    "/root/repo/spatialops/structured/FVStaggeredBCTools.h"
+    "/root/repo/spatialops/structured/FVStaggeredLocationTypes.h"
+    "/root/repo/spatialops/structured/FVStaggeredFieldTypes.h"
+    "/root/repo/spatialops/structured/FVTools.h"
+    "/root/repo/spatialops/structured/Grid.h"
+    "/root/repo/spatialops/structured/GhostData.h"
+    "/root/repo/spatialops/structured/IndexTriplet.h"
+    "/root/repo/spatialops/structured/IntVec.h"
+    "/root/repo/spatialops/structured/Numeric3Vec.h"
+    "/root/repo/spatialops/structured/ExternalAllocators.h"
+    "/root/repo/spatialops/structured/CudaMemoryAllocator.h"
+    "/root/repo/spatialops/structured/MemoryPool.h"
+    "/root/repo/spatialops/structured/MemoryTypes.h"
+    "/root/repo/spatialops/structured/MemoryWindow.h"
+    "/root/repo/spatialops/structured/FieldComparisons.h"
+    "/root/repo/spatialops/structured/SpatialField.h"
+    "/root/repo/spatialops/structured/SpatialMask.h"
+    "/root/repo/spatialops/structured/BitField.h"
+    "/root/repo/spatialops/structured/SpatialFieldStore.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/spatialops" TYPE STATIC_LIBRARY PERMISSIONS OWNER_READ GROUP_READ WORLD_READ FILES "/root/repo/_simd_build/spatialops/structured/libspatialops-structured.a")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_simd_build/spatialops/structured/test/cmake_install.cmake")
+  include("/root/repo/_simd_build/spatialops/structured/onedim/cmake_install.cmake")
+  include("/root/repo/_simd_build/spatialops/structured/stencil/cmake_install.cmake")
+
+endif()
+
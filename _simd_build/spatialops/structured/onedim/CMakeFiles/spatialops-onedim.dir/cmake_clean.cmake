@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spatialops-onedim.dir/LagrangePoly.cpp.o"
+  "CMakeFiles/spatialops-onedim.dir/LagrangePoly.cpp.o.d"
+  "libspatialops-onedim.a"
+  "libspatialops-onedim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spatialops-onedim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
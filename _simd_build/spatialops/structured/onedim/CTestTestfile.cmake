@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/structured/onedim
+# Build directory: /root/repo/_simd_build/spatialops/structured/onedim
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("test")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lagrange.dir/testLagrange.cpp.o"
+  "CMakeFiles/lagrange.dir/testLagrange.cpp.o.d"
+  "lagrange"
+  "lagrange.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lagrange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/structured/onedim/test
+# Build directory: /root/repo/_simd_build/spatialops/structured/onedim/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(lagrange_coefficients "lagrange")
+set_tests_properties(lagrange_coefficients PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/onedim/test/CMakeLists.txt;3;add_test;/root/repo/spatialops/structured/onedim/test/CMakeLists.txt;0;")
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/spatialops/structured/stencil/StencilBuilder.cpp" "spatialops/structured/stencil/CMakeFiles/spatialops-stencil.dir/StencilBuilder.cpp.o" "gcc" "spatialops/structured/stencil/CMakeFiles/spatialops-stencil.dir/StencilBuilder.cpp.o.d"
+  "/root/repo/spatialops/structured/stencil/StencilInstantiations.cpp" "spatialops/structured/stencil/CMakeFiles/spatialops-stencil.dir/StencilInstantiations.cpp.o" "gcc" "spatialops/structured/stencil/CMakeFiles/spatialops-stencil.dir/StencilInstantiations.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
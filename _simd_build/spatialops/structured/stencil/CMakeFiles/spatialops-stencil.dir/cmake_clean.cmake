@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spatialops-stencil.dir/StencilBuilder.cpp.o"
+  "CMakeFiles/spatialops-stencil.dir/StencilBuilder.cpp.o.d"
+  "CMakeFiles/spatialops-stencil.dir/StencilInstantiations.cpp.o"
+  "CMakeFiles/spatialops-stencil.dir/StencilInstantiations.cpp.o.d"
+  "libspatialops-stencil.a"
+  "libspatialops-stencil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spatialops-stencil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bc_stencil.dir/testOpBC.cpp.o"
+  "CMakeFiles/test_bc_stencil.dir/testOpBC.cpp.o.d"
+  "test_bc_stencil"
+  "test_bc_stencil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bc_stencil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_chain_stencil_tiled.dir/test_chain_stencil.cpp.o"
+  "CMakeFiles/test_chain_stencil_tiled.dir/test_chain_stencil.cpp.o.d"
+  "test_chain_stencil_tiled"
+  "test_chain_stencil_tiled.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_chain_stencil_tiled.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_collapse_stencil.dir/test_collapse_stencil.cpp.o"
+  "CMakeFiles/test_collapse_stencil.dir/test_collapse_stencil.cpp.o.d"
+  "test_collapse_stencil"
+  "test_collapse_stencil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_collapse_stencil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_const_coef_stencil.dir/test_const_coef_stencil.cpp.o"
+  "CMakeFiles/test_const_coef_stencil.dir/test_const_coef_stencil.cpp.o.d"
+  "test_const_coef_stencil"
+  "test_const_coef_stencil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_const_coef_stencil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
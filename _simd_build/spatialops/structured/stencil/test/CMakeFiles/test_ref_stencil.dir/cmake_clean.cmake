@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ref_stencil.dir/test_ref_stencil.cpp.o"
+  "CMakeFiles/test_ref_stencil.dir/test_ref_stencil.cpp.o.d"
+  "test_ref_stencil"
+  "test_ref_stencil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ref_stencil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_stencil2.dir/test_stencil2.cpp.o"
+  "CMakeFiles/test_stencil2.dir/test_stencil2.cpp.o.d"
+  "test_stencil2"
+  "test_stencil2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stencil2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_stencil4.dir/test_stencil4.cpp.o"
+  "CMakeFiles/test_stencil4.dir/test_stencil4.cpp.o.d"
+  "test_stencil4"
+  "test_stencil4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stencil4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,146 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/structured/stencil/test
+# Build directory: /root/repo/_simd_build/spatialops/structured/stencil/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ref_stencil_x_nobc "test_ref_stencil" "--ny=1" "--nz=1")
+set_tests_properties(ref_stencil_x_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;7;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_x_bc "test_ref_stencil" "--ny=1" "--nz=1" "--bcx")
+set_tests_properties(ref_stencil_x_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;8;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_y_nobc "test_ref_stencil" "--nx=1" "--nz=1")
+set_tests_properties(ref_stencil_y_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;9;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_y_bc "test_ref_stencil" "--nx=1" "--nz=1" "--bcy")
+set_tests_properties(ref_stencil_y_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;10;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_z_nobc "test_ref_stencil" "--ny=1" "--nx=1")
+set_tests_properties(ref_stencil_z_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;11;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_z_bc "test_ref_stencil" "--ny=1" "--nx=1" "--bcz")
+set_tests_properties(ref_stencil_z_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;12;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcxyz "test_ref_stencil" "--bcx" "--bcy" "--bcz")
+set_tests_properties(ref_stencil_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;13;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcxy "test_ref_stencil" "--bcx" "--bcy")
+set_tests_properties(ref_stencil_bcxy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;14;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcxz "test_ref_stencil" "--bcx" "--bcz")
+set_tests_properties(ref_stencil_bcxz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;15;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcyz "test_ref_stencil" "--bcz" "--bcy")
+set_tests_properties(ref_stencil_bcyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;16;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcx "test_ref_stencil" "--bcx")
+set_tests_properties(ref_stencil_bcx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;17;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcy "test_ref_stencil" "--bcy")
+set_tests_properties(ref_stencil_bcy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;18;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_bcz "test_ref_stencil" "--bcz")
+set_tests_properties(ref_stencil_bcz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;19;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_no_bc "test_ref_stencil")
+set_tests_properties(ref_stencil_no_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;20;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_no_bc2 "test_ref_stencil" "--nx" "8" "--ny" "11" "--nz" "12")
+set_tests_properties(ref_stencil_no_bc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;21;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(ref_stencil_no_bc3 "test_ref_stencil" "--nx" "11" "--ny" "8" "--nz" "9")
+set_tests_properties(ref_stencil_no_bc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;22;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_x_nobc "test_stencil2" "--ny=1" "--nz=1")
+set_tests_properties(stencil2_x_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;26;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_x_bc "test_stencil2" "--ny=1" "--nz=1" "--bcx")
+set_tests_properties(stencil2_x_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;27;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_y_nobc "test_stencil2" "--nx=1" "--nz=1")
+set_tests_properties(stencil2_y_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;28;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_y_bc "test_stencil2" "--nx=1" "--nz=1" "--bcy")
+set_tests_properties(stencil2_y_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;29;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_z_nobc "test_stencil2" "--ny=1" "--nx=1")
+set_tests_properties(stencil2_z_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;30;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_z_bc "test_stencil2" "--ny=1" "--nx=1" "--bcz")
+set_tests_properties(stencil2_z_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;31;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcxyz "test_stencil2" "--bcx" "--bcy" "--bcz")
+set_tests_properties(stencil2_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;32;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcxy "test_stencil2" "--bcx" "--bcy")
+set_tests_properties(stencil2_bcxy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;33;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcxz "test_stencil2" "--bcx" "--bcz")
+set_tests_properties(stencil2_bcxz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;34;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcyz "test_stencil2" "--bcz" "--bcy")
+set_tests_properties(stencil2_bcyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;35;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcx "test_stencil2" "--bcx")
+set_tests_properties(stencil2_bcx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;36;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcy "test_stencil2" "--bcy")
+set_tests_properties(stencil2_bcy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;37;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_bcz "test_stencil2" "--bcz")
+set_tests_properties(stencil2_bcz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;38;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_no_bc "test_stencil2")
+set_tests_properties(stencil2_no_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;39;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_no_bc2 "test_stencil2" "--nx" "8" "--ny" "11" "--nz" "12")
+set_tests_properties(stencil2_no_bc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;40;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil2_no_bc3 "test_stencil2" "--nx" "11" "--ny" "8" "--nz" "9")
+set_tests_properties(stencil2_no_bc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;41;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_bcx "test_stencil4" "--bcx")
+set_tests_properties(stencil4_bcx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;45;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_bcy "test_stencil4" "--bcy")
+set_tests_properties(stencil4_bcy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;46;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_bcz "test_stencil4" "--bcz")
+set_tests_properties(stencil4_bcz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;47;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_bcxy "test_stencil4" "--bcx" "--bcy")
+set_tests_properties(stencil4_bcxy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;48;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_bcyz "test_stencil4" "--bcy" "--bcz")
+set_tests_properties(stencil4_bcyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;49;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_bczx "test_stencil4" "--bcz" "--bcx")
+set_tests_properties(stencil4_bczx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;50;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_3xyz "test_stencil4" "--nx=6" "--ny=8" "--nz=10" "--bcx" "--bcy" "--bcz")
+set_tests_properties(stencil4_3xyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;51;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(stencil4_3 "test_stencil4" "--nx=7" "--ny=9" "--nz=11")
+set_tests_properties(stencil4_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;52;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(test_bc_op_stencil "test_bc_stencil")
+set_tests_properties(test_bc_op_stencil PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;56;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(test_filter "test_filter")
+set_tests_properties(test_filter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;60;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_x_nobc "test_chain_stencil" "--ny=1" "--nz=1")
+set_tests_properties(chain_stencil_x_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;64;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_x_bc "test_chain_stencil" "--ny=1" "--nz=1" "--bcx")
+set_tests_properties(chain_stencil_x_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;65;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_y_nobc "test_chain_stencil" "--nx=1" "--nz=1")
+set_tests_properties(chain_stencil_y_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;66;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_y_bc "test_chain_stencil" "--nx=1" "--nz=1" "--bcy")
+set_tests_properties(chain_stencil_y_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;67;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_z_nobc "test_chain_stencil" "--ny=1" "--nx=1")
+set_tests_properties(chain_stencil_z_nobc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;68;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_z_bc "test_chain_stencil" "--ny=1" "--nx=1" "--bcz")
+set_tests_properties(chain_stencil_z_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;69;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcxyz "test_chain_stencil" "--bcx" "--bcy" "--bcz")
+set_tests_properties(chain_stencil_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;70;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcxy "test_chain_stencil" "--bcx" "--bcy")
+set_tests_properties(chain_stencil_bcxy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;71;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcxz "test_chain_stencil" "--bcx" "--bcz")
+set_tests_properties(chain_stencil_bcxz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;72;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcyz "test_chain_stencil" "--bcz" "--bcy")
+set_tests_properties(chain_stencil_bcyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;73;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcx "test_chain_stencil" "--bcx")
+set_tests_properties(chain_stencil_bcx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;74;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcy "test_chain_stencil" "--bcy")
+set_tests_properties(chain_stencil_bcy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;75;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_bcz "test_chain_stencil" "--bcz")
+set_tests_properties(chain_stencil_bcz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;76;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_no_bc "test_chain_stencil")
+set_tests_properties(chain_stencil_no_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;77;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_no_bc2 "test_chain_stencil" "--nx" "8" "--ny" "11" "--nz" "12")
+set_tests_properties(chain_stencil_no_bc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;78;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_no_bc3 "test_chain_stencil" "--nx" "11" "--ny" "8" "--nz" "9")
+set_tests_properties(chain_stencil_no_bc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;79;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_tiled_bcxyz "test_chain_stencil_tiled" "--bcx" "--bcy" "--bcz")
+set_tests_properties(chain_stencil_tiled_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;85;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_tiled_no_bc "test_chain_stencil_tiled")
+set_tests_properties(chain_stencil_tiled_no_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;86;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_tiled_no_bc2 "test_chain_stencil_tiled" "--nx" "8" "--ny" "11" "--nz" "12")
+set_tests_properties(chain_stencil_tiled_no_bc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;87;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_tiled_no_bc3 "test_chain_stencil_tiled" "--nx" "11" "--ny" "8" "--nz" "9")
+set_tests_properties(chain_stencil_tiled_no_bc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;88;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_nested_bcxyz "test_chain_stencil_nested" "--bcx" "--bcy" "--bcz")
+set_tests_properties(chain_stencil_nested_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;94;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_nested_no_bc "test_chain_stencil_nested")
+set_tests_properties(chain_stencil_nested_no_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;95;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_nested_no_bc2 "test_chain_stencil_nested" "--nx" "8" "--ny" "11" "--nz" "12")
+set_tests_properties(chain_stencil_nested_no_bc2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;96;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(chain_stencil_nested_no_bc3 "test_chain_stencil_nested" "--nx" "11" "--ny" "8" "--nz" "9")
+set_tests_properties(chain_stencil_nested_no_bc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;97;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(collapse_stencil "test_collapse_stencil")
+set_tests_properties(collapse_stencil PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;101;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(collapse_stencil_bcxyz "test_collapse_stencil" "--bcx" "--bcy" "--bcz")
+set_tests_properties(collapse_stencil_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;102;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(const_coef_stencil "test_const_coef_stencil")
+set_tests_properties(const_coef_stencil PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;106;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
+add_test(const_coef_stencil_bcxyz "test_const_coef_stencil" "--bcx" "--bcy" "--bcz")
+set_tests_properties(const_coef_stencil_bcxyz PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;107;add_test;/root/repo/spatialops/structured/stencil/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_field_compare.dir/testFieldComparisons.cpp.o"
+  "CMakeFiles/test_field_compare.dir/testFieldComparisons.cpp.o.d"
+  "test_field_compare"
+  "test_field_compare.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_field_compare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
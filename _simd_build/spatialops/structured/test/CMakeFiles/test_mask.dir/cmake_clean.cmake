@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mask.dir/testMask.cpp.o"
+  "CMakeFiles/test_mask.dir/testMask.cpp.o.d"
+  "test_mask"
+  "test_mask.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
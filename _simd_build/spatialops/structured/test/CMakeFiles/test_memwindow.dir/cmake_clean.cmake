@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memwindow.dir/testMemWindow.cpp.o"
+  "CMakeFiles/test_memwindow.dir/testMemWindow.cpp.o.d"
+  "test_memwindow"
+  "test_memwindow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memwindow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
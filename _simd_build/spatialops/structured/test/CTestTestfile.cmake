@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/spatialops/structured/test
+# Build directory: /root/repo/_simd_build/spatialops/structured/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_field_compare "test_field_compare")
+set_tests_properties(test_field_compare PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;9;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
+add_test(test_mask "test_mask")
+set_tests_properties(test_mask PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;13;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
+add_test(test_field "test_field")
+set_tests_properties(test_field PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;17;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
+add_test(test_memwindow "test_memwindow")
+set_tests_properties(test_memwindow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;21;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
+add_test(test_grid "test_grid")
+set_tests_properties(test_grid PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;25;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
+add_test(test_tools "test_tools")
+set_tests_properties(test_tools PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;29;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
+add_test(test_bc "test_bc")
+set_tests_properties(test_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/spatialops/structured/test/CMakeLists.txt;33;add_test;/root/repo/spatialops/structured/test/CMakeLists.txt;0;")
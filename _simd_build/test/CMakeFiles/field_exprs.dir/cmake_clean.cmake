@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/field_exprs.dir/testFieldExprs.cpp.o"
+  "CMakeFiles/field_exprs.dir/testFieldExprs.cpp.o.d"
+  "field_exprs"
+  "field_exprs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/field_exprs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fused_assign.dir/FusedAssignmentTest.cpp.o"
+  "CMakeFiles/fused_assign.dir/FusedAssignmentTest.cpp.o.d"
+  "fused_assign"
+  "fused_assign.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fused_assign.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
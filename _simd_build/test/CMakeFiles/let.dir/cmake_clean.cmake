@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/let.dir/LetTest.cpp.o"
+  "CMakeFiles/let.dir/LetTest.cpp.o.d"
+  "let"
+  "let.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/let.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
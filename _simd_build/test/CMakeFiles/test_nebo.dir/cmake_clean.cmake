@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_nebo.dir/NeboTest.cpp.o"
+  "CMakeFiles/test_nebo.dir/NeboTest.cpp.o.d"
+  "test_nebo"
+  "test_nebo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_nebo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
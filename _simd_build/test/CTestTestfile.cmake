@@ -0,0 +1,25 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_simd_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(field_exprs "field_exprs")
+set_tests_properties(field_exprs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;7;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_nebo "test_nebo")
+set_tests_properties(test_nebo PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;11;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_assign "fused_assign")
+set_tests_properties(fused_assign PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;15;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fused_assign_bc "fused_assign" "--bcx" "--bcy" "--bcz")
+set_tests_properties(fused_assign_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reductions "reductions")
+set_tests_properties(reductions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;20;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reductions_bc "reductions" "--bcx" "--bcy" "--bcz")
+set_tests_properties(reductions_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;21;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(reduction_benchmark "reduction_benchmark" "--runs" "5")
+set_tests_properties(reduction_benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;25;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(let "let")
+set_tests_properties(let PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;29;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(let_bc "let" "--bcx" "--bcy" "--bcz")
+set_tests_properties(let_bc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;30;add_test;/root/repo/test/CMakeLists.txt;0;")
+subdirs("heatEqn")
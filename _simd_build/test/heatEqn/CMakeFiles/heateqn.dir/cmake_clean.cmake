@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/heateqn.dir/main.cpp.o"
+  "CMakeFiles/heateqn.dir/main.cpp.o.d"
+  "heateqn"
+  "heateqn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/heateqn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
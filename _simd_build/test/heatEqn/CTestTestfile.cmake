@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/heatEqn
+# Build directory: /root/repo/_simd_build/test/heatEqn
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(heateqn "heateqn")
+set_tests_properties(heateqn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/heatEqn/CMakeLists.txt;5;add_test;/root/repo/test/heatEqn/CMakeLists.txt;0;")
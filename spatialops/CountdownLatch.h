@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_CountdownLatch_h
+#define Nebo_CountdownLatch_h
+
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace SpatialOps{
+
+  /** @brief a short pause for spin-wait loops */
+  inline void cpu_relax()
+  {
+#   if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#   endif
+  }
+
+  /**
+   * @class CountdownLatch
+   *
+   * @brief Lets one thread wait for a known number of tasks to finish
+   * (fork/join).
+   *
+   * Each task calls \c count_down once, which is a single atomic decrement.
+   * The waiting thread spins for a bounded time and only then parks on a
+   * condition variable.  In that case the last task to finish wakes it, and
+   * no other task takes a lock.
+   *
+   * Once \c wait returns, no task touches the latch again, so it may live on
+   * the waiting thread's stack.
+   */
+  class CountdownLatch {
+  public:
+
+    /**
+     * @param count the number of calls to \c count_down that \c wait waits for
+     */
+    explicit CountdownLatch( const int count ) : state_(count), released_(false) {}
+
+    /** @brief mark one task as finished */
+    inline void count_down() {
+      // the waiter sets parkedBit once, so this is the last task to finish
+      // and the waiter has parked exactly when the old state is parkedBit+1
+      if( state_.fetch_sub(1) == (parkedBit | 1u) ){
+        boost::lock_guard<boost::mutex> lock(mut_);
+        released_ = true;
+        cond_.notify_one();
+      }
+    }
+
+    /**
+     * @brief expect \c n more calls to \c count_down.  Only the waiting
+     *  thread may call this, and only before it calls \c wait.
+     */
+    inline void add( const int n ){ state_.fetch_add(n); }
+
+    /**
+     * @brief Wait until \c count_down has been called \c count times.
+     */
+    inline void wait() {
+      for( int spin=0; spin<spinLimit; ++spin ){
+        if( state_.load(boost::memory_order_acquire) == 0 ) return;
+        cpu_relax();
+      }
+      boost::unique_lock<boost::mutex> lock(mut_);
+      if( state_.fetch_or(parkedBit) == 0 ) return;
+      while( !released_ ) cond_.wait(lock);
+    }
+
+  private:
+    static const unsigned parkedBit = 1u << 31;
+    static const int spinLimit = 256;
+
+    boost::atomic<unsigned> state_;  ///< tasks outstanding, plus parkedBit once the waiter sleeps
+    boost::mutex mut_;
+    boost::condition_variable cond_;
+    bool released_;
+
+    CountdownLatch( const CountdownLatch& );
+    CountdownLatch& operator=( const CountdownLatch& );
+  };
+}
+#endif // Nebo_CountdownLatch_h
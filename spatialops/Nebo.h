@@ -32,8 +32,12 @@
 #include <spatialops/NeboCond.h>
 #include <spatialops/NeboStencils.h>
 #include <spatialops/NeboStencilBuilder.h>
+#include <spatialops/NeboStencilConstCoefs.h>
+#include <spatialops/NeboLet.h>
 #include <spatialops/NeboLhs.h>
 #include <spatialops/NeboAssignment.h>
+#include <spatialops/NeboFusedAssignment.h>
+#include <spatialops/NeboReductionWalk.h>
 #include <spatialops/NeboReductions.h>
 
 
@@ -31,6 +31,7 @@
    #include <spatialops/structured/SpatialField.h>
    #include <spatialops/structured/SpatialMask.h>
    #include <spatialops/structured/FVStaggeredFieldTypes.h>
+   #include <spatialops/NeboTiling.h>
    #include <cmath>
    #include <math.h>
 
@@ -39,13 +40,19 @@
    #endif
    /* NEBO_REPORT_BACKEND */
 
+   #ifdef NEBO_SIMD
+      #include <spatialops/NeboSIMD.h>
+   #endif
+   /* NEBO_SIMD */
+
    #ifdef FIELD_EXPRESSION_THREADS
       #include <spatialops/SpatialOpsTools.h>
       #include <vector>
       #include <boost/bind.hpp>
       #include <spatialops/ThreadPool.h>
       #include <spatialops/structured/IntVec.h>
-      #include <spatialops/Semaphore.h>
+      #include <spatialops/CountdownLatch.h>
+      #include <spatialops/NeboParallelRegion.h>
    #endif
    /* FIELD_EXPRESSION_THREADS */
 
@@ -269,6 +276,10 @@
       #endif
       /* FIELD_EXPRESSION_THREADS */;
       struct SeqWalk;
+      #ifdef NEBO_SIMD
+         struct SIMDWalk
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          struct GPUWalk
       #endif
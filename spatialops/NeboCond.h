@@ -34,6 +34,11 @@
 
          NeboNil typedef SeqWalkType;
 
+         #ifdef NEBO_SIMD
+            NeboNil typedef SIMDWalkType;
+         #endif
+         /* NEBO_SIMD */
+
          #ifdef __CUDACC__
             NeboNil typedef GPUWalkType;
          #endif
@@ -75,6 +80,14 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboClause<SIMDWalk,
+                        typename Test::SIMDWalkType,
+                        typename Expr::SIMDWalkType,
+                        FieldType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboClause<Reduction,
                      typename Test::ReductionType,
                      typename Expr::ReductionType,
@@ -88,6 +101,11 @@
              return min(test_.possible_ghosts(), expr_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(test_.extent(minus, plus), expr_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -95,6 +113,16 @@
                                 expr_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(test_.simd_init(minus, plus, shift),
+                                    expr_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -190,17 +218,62 @@
           : test_(test), expr_(expr)
           {}
 
-          inline void next(void) { test_.next(); expr_.next(); }
-
-          inline value_type eval(void) const { return expr_.eval(); }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return expr_.eval(x, y, z);
+          }
 
-          inline bool check(void) const { return test_.eval(); }
+          inline bool check(int const x, int const y, int const z) const {
+             return test_.eval(x, y, z);
+          }
 
          private:
           Test test_;
 
           Expr expr_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Test, typename Expr, typename FieldType>
+          struct NeboClause<SIMDWalk, Test, Expr, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboClause(Test const & test, Expr const & expr)
+             : test_(test), expr_(expr)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return expr_.eval(x, y, z);
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return expr_.pack_eval(x, y, z);
+             }
+
+             inline bool check(int const x, int const y, int const z) const {
+                return test_.eval(x, y, z);
+             }
+
+             inline NeboSIMDMask pack_check(int const x,
+                                            int const y,
+                                            int const z) const {
+                return nebo_simd_test(test_.pack_eval(x, y, z));
+             }
+
+            private:
+             Test test_;
+
+             Expr expr_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Test, typename Expr, typename FieldType>
           struct NeboClause<GPUWalk, Test, Expr, FieldType> {
@@ -294,6 +367,14 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboCond<SIMDWalk,
+                      typename ClauseType::SIMDWalkType,
+                      typename Otherwise::SIMDWalkType,
+                      FieldType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboCond<Reduction,
                    typename ClauseType::ReductionType,
                    typename Otherwise::ReductionType,
@@ -307,6 +388,11 @@
              return min(clause_.possible_ghosts(), otherwise_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(clause_.extent(minus, plus), otherwise_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -314,6 +400,16 @@
                                 otherwise_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(clause_.simd_init(minus, plus, shift),
+                                    otherwise_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -413,10 +509,9 @@
           : clause_(clause), otherwise_(otherwise)
           {}
 
-          inline void next(void) { clause_.next(); otherwise_.next(); }
-
-          inline value_type eval(void) const {
-             return (clause_.check() ? clause_.eval() : otherwise_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return (clause_.check(x, y, z) ? clause_.eval(x, y, z) :
+                     otherwise_.eval(x, y, z));
           }
 
          private:
@@ -424,6 +519,42 @@
 
           Otherwise otherwise_;
       };
+      #ifdef NEBO_SIMD
+         template<typename ClauseType, typename Otherwise, typename FieldType>
+          struct NeboCond<SIMDWalk, ClauseType, Otherwise, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboCond(ClauseType const & clause, Otherwise const & otherwise)
+             : clause_(clause), otherwise_(otherwise)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return (clause_.check(x, y, z) ? clause_.eval(x, y, z) :
+                        otherwise_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return (clause_.pack_check(x, y, z) ?
+                        clause_.pack_eval(x, y, z) :
+                        otherwise_.pack_eval(x, y, z));
+             }
+
+            private:
+             ClauseType clause_;
+
+             Otherwise otherwise_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename ClauseType, typename Otherwise, typename FieldType>
           struct NeboCond<GPUWalk, ClauseType, Otherwise, FieldType> {
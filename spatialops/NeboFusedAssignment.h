@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_FusedAssignment_h
+#define Nebo_FusedAssignment_h
+
+#include <sstream>
+#include <stdexcept>
+
+#include <spatialops/NeboBasic.h>
+#include <spatialops/NeboRhs.h>
+#include <spatialops/NeboLhs.h>
+
+/**
+ * \file NeboFusedAssignment.h
+ *
+ * Fused Nebo assignments: several statements of the form
+ * <tt>lhs <<= rhs</tt> whose left-hand sides cover the same window are
+ * evaluated in a single traversal of that window, e.g.
+ *
+ * \code
+ *   nebo_fused_assign( nebo_statement( f1, sin(t) * y1 ),
+ *                      nebo_statement( f2, sin(t) * y2 ),
+ *                      nebo_statement( f3, sin(t) * y3 ) );
+ * \endcode
+ *
+ * rather than three passes that each stream \c t through memory again.
+ * At each point every right-hand side is evaluated before any result is
+ * stored, so operands that the statements share are fetched from memory
+ * once per point and each destination is written once.
+ *
+ * The statements must be independent: no right-hand side may read a
+ * left-hand side of another statement of the same fusion.  Their
+ * left-hand sides must have the same extent once restricted to the ghost
+ * cells that all right-hand sides can fill; an exception is thrown
+ * otherwise.  Fields that are not on the CPU are assigned one statement
+ * after another.
+ */
+
+namespace SpatialOps{
+
+  /**
+   * @struct NeboStatement
+   * @brief The assignment <tt>lhs <<= rhs</tt>, held for nebo_fused_assign.
+   *  Built with nebo_statement.
+   */
+  template<typename RhsType, typename FieldType>
+  struct NeboStatement{
+    FieldType typedef field_type;
+    typename FieldType::value_type typedef value_type;
+
+    /* the statement restricted to one window: evaluates and stores a point */
+    template<typename RhsWalkType>
+    struct Walk{
+      Walk( FieldType f, const RhsWalkType& rhs )
+        : base_( f.field_values(LOCAL_RAM) + f.window_with_ghost().offset(0)
+                 + f.window_with_ghost().glob_dim(0) * ( f.window_with_ghost().offset(1)
+                                                         + f.window_with_ghost().glob_dim(1)
+                                                         * f.window_with_ghost().offset(2) ) ),
+          xGlob_( f.window_with_ghost().glob_dim(0) ),
+          yGlob_( f.window_with_ghost().glob_dim(1) ),
+          rhs_( rhs )
+      {}
+
+      inline value_type eval( const int x, const int y, const int z ) const{ return rhs_.eval(x,y,z); }
+      inline void store( const int x, const int y, const int z, const value_type v ){
+        base_[ x + xGlob_ * ( y + yGlob_ * z ) ] = v;
+      }
+      inline void assign( const int x, const int y, const int z ){ store( x, y, z, eval(x,y,z) ); }
+
+#     ifdef NEBO_SIMD
+      typename NeboSIMDPack<value_type>::type typedef pack_type;
+      enum { vectorized = NeboSIMDPack<value_type>::vectorized };
+
+      inline pack_type pack_eval( const int x, const int y, const int z ) const{ return rhs_.pack_eval(x,y,z); }
+      inline void pack_store( const int x, const int y, const int z, const pack_type v ){
+        NeboSIMDPack<value_type>::store( base_ + x + xGlob_ * ( y + yGlob_ * z ), v );
+      }
+      inline void pack_assign( const int x, const int y, const int z ){ pack_store( x, y, z, pack_eval(x,y,z) ); }
+#     endif
+
+    private:
+      value_type * const base_;
+      const int xGlob_, yGlob_;
+      const RhsWalkType rhs_;
+    };
+
+    Walk<typename RhsType::SeqWalkType> typedef SeqWalkType;
+#   ifdef NEBO_SIMD
+    Walk<typename RhsType::SIMDWalkType> typedef SIMDWalkType;
+#   endif
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    /* the statement resized to the fused window, ready to be partitioned */
+    struct ResizeType{
+      ResizeType( const FieldType& lhs, const typename RhsType::ResizeType& rhs ) : lhs_(lhs), rhs_(rhs) {}
+      inline SeqWalkType init( const structured::IntVec& split, const structured::IntVec& location ) const{
+        return SeqWalkType( FieldType( lhs_.window_with_ghost().refine(split,location), lhs_ ),
+                            rhs_.init( structured::IntVec(0,0,0), split, location ) );
+      }
+    private:
+      const FieldType lhs_;
+      const typename RhsType::ResizeType rhs_;
+    };
+#   endif
+
+    NeboStatement( FieldType lhs, const RhsType& rhs )
+      : lhs_(lhs), rhs_(rhs)
+#     ifdef FIELD_EXPRESSION_THREADS
+      , partitions_(lhs.get_partition_count())
+#     endif
+    {}
+
+    /** @brief the ghost cells that the right-hand side can fill */
+    inline structured::GhostData valid_ghost( const bool useGhost ) const{
+      return calculate_valid_ghost( useGhost, lhs_.get_ghost_data(), lhs_.boundary_info(), rhs_.possible_ghosts() );
+    }
+
+    /** @brief the left-hand side restricted to the given (right-hand side) ghost cells */
+    inline FieldType lhs( const structured::GhostData& ghosts ) const{
+      const structured::GhostData lhsGhosts = calculate_valid_lhs_ghost( ghosts, lhs_.boundary_info() );
+      return resize_ghost( lhs_, lhsGhosts.get_minus(), lhsGhosts.get_plus() );
+    }
+
+    inline structured::MemoryWindow window( const structured::GhostData& ghosts ) const{
+      return lhs( ghosts ).window_with_ghost();
+    }
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    inline int partition_count() const{ return partitions_; }
+#   endif
+
+    inline bool cpu_ready() const{
+      return LOCAL_RAM == lhs_.memory_device_type() && rhs_.cpu_ready();
+    }
+
+    /** @brief perform the assignment on its own */
+    inline void assign_each() const{
+      NeboField<Initial,FieldType>( lhs_ ).template assign<RhsType>( true, rhs_ );
+    }
+
+    inline SeqWalkType init( const structured::GhostData& ghosts ) const{
+      return SeqWalkType( lhs( ghosts ), rhs_.init( ghosts.get_minus(), ghosts.get_plus(), structured::IntVec(0,0,0) ) );
+    }
+
+#   ifdef NEBO_SIMD
+    inline SIMDWalkType simd_init( const structured::GhostData& ghosts ) const{
+      return SIMDWalkType( lhs( ghosts ), rhs_.simd_init( ghosts.get_minus(), ghosts.get_plus(), structured::IntVec(0,0,0) ) );
+    }
+#   endif
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    inline ResizeType resize( const structured::GhostData& ghosts ) const{
+      return ResizeType( lhs( ghosts ), rhs_.resize( ghosts.get_minus(), ghosts.get_plus() ) );
+    }
+#   endif
+
+  private:
+    FieldType lhs_;
+    RhsType rhs_;
+#   ifdef FIELD_EXPRESSION_THREADS
+    int partitions_;
+#   endif
+  };
+
+  /**
+   * @struct NeboFusedStatements
+   * @brief A statement followed by the statements \c Rest (a NeboStatement
+   *  or another NeboFusedStatements), with the same interface as a single
+   *  NeboStatement.
+   */
+  template<typename First, typename Rest>
+  struct NeboFusedStatements{
+
+    template<typename FirstWalk, typename RestWalk>
+    struct Walk{
+      Walk( const FirstWalk& first, const RestWalk& rest ) : first_(first), rest_(rest) {}
+
+      // the rest stores its results only after this statement has been evaluated
+      inline void assign( const int x, const int y, const int z ){
+        const typename First::value_type v = first_.eval(x,y,z);
+        rest_.assign(x,y,z);
+        first_.store(x,y,z,v);
+      }
+
+#     ifdef NEBO_SIMD
+      enum { vectorized = FirstWalk::vectorized && RestWalk::vectorized };
+
+      inline void pack_assign( const int x, const int y, const int z ){
+        const typename FirstWalk::pack_type v = first_.pack_eval(x,y,z);
+        rest_.pack_assign(x,y,z);
+        first_.pack_store(x,y,z,v);
+      }
+#     endif
+
+    private:
+      FirstWalk first_;
+      RestWalk rest_;
+    };
+
+    Walk<typename First::SeqWalkType, typename Rest::SeqWalkType> typedef SeqWalkType;
+#   ifdef NEBO_SIMD
+    Walk<typename First::SIMDWalkType, typename Rest::SIMDWalkType> typedef SIMDWalkType;
+#   endif
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    struct ResizeType{
+      ResizeType( const typename First::ResizeType& first, const typename Rest::ResizeType& rest ) : first_(first), rest_(rest) {}
+      inline SeqWalkType init( const structured::IntVec& split, const structured::IntVec& location ) const{
+        return SeqWalkType( first_.init(split,location), rest_.init(split,location) );
+      }
+    private:
+      const typename First::ResizeType first_;
+      const typename Rest::ResizeType rest_;
+    };
+#   endif
+
+    NeboFusedStatements( const First& first, const Rest& rest ) : first_(first), rest_(rest) {}
+
+    inline structured::GhostData valid_ghost( const bool useGhost ) const{
+      return min( first_.valid_ghost(useGhost), rest_.valid_ghost(useGhost) );
+    }
+
+    inline structured::MemoryWindow window( const structured::GhostData& ghosts ) const{
+      const structured::MemoryWindow w = first_.window( ghosts );
+      if( w.extent() != rest_.window( ghosts ).extent() ){
+        std::ostringstream msg;
+        msg << "Nebo error in " << "Nebo Fused Assignment" << ":\n";
+        msg << "Left-hand sides of fused statements do not cover the same extent";
+        msg << "\n";
+        msg << "\t - " << __FILE__ << " : " << __LINE__;
+        throw(std::runtime_error(msg.str()));
+      }
+      return w;
+    }
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    inline int partition_count() const{ return first_.partition_count(); }
+#   endif
+
+    inline bool cpu_ready() const{ return first_.cpu_ready() && rest_.cpu_ready(); }
+
+    inline void assign_each() const{ first_.assign_each(); rest_.assign_each(); }
+
+    inline SeqWalkType init( const structured::GhostData& ghosts ) const{
+      return SeqWalkType( first_.init(ghosts), rest_.init(ghosts) );
+    }
+
+#   ifdef NEBO_SIMD
+    inline SIMDWalkType simd_init( const structured::GhostData& ghosts ) const{
+      return SIMDWalkType( first_.simd_init(ghosts), rest_.simd_init(ghosts) );
+    }
+#   endif
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    inline ResizeType resize( const structured::GhostData& ghosts ) const{
+      return ResizeType( first_.resize(ghosts), rest_.resize(ghosts) );
+    }
+#   endif
+
+  private:
+    First first_;
+    Rest rest_;
+  };
+
+  //------------------------------------------------------------------
+
+  /* traversal of the fused window, shared by the sequential and threaded backends */
+  template<typename WalkType>
+  inline void nebo_fused_walk( WalkType walk, const structured::IntVec& extent )
+  {
+    for( int z=0; z<extent[2]; ++z ){
+      for( int y=0; y<extent[1]; ++y ){
+        for( int x=0; x<extent[0]; ++x ) walk.assign(x,y,z);
+      }
+    }
+  }
+
+# ifdef NEBO_SIMD
+  template<typename WalkType>
+  inline void nebo_fused_simd_walk( WalkType walk, const structured::IntVec& extent )
+  {
+    const int xPacked = WalkType::vectorized ? extent[0] - extent[0] % NEBO_SIMD_WIDTH : 0;
+    for( int z=0; z<extent[2]; ++z ){
+      for( int y=0; y<extent[1]; ++y ){
+        int x=0;
+        for( ; x<xPacked; x+=NEBO_SIMD_WIDTH ) walk.pack_assign(x,y,z);
+        for( ; x<extent[0]; ++x ) walk.assign(x,y,z);
+      }
+    }
+  }
+# endif
+
+# ifdef FIELD_EXPRESSION_THREADS
+  template<typename ResizeType>
+  inline void nebo_fused_partition( const ResizeType resized,
+                                    const structured::MemoryWindow window,
+                                    const structured::IntVec split,
+                                    const structured::IntVec location,
+                                    CountdownLatch* latch )
+  {
+    nebo_fused_walk( resized.init( split, location ), window.refine( split, location ).extent() );
+    latch->count_down();
+  }
+# endif
+
+  template<typename Statements>
+  inline void nebo_fused_assign_statements( const Statements& statements )
+  {
+#   ifdef __CUDACC__
+    if( !statements.cpu_ready() ){
+      statements.assign_each();
+      return;
+    }
+#   endif
+
+    const structured::GhostData ghosts = statements.valid_ghost( true );
+    const structured::MemoryWindow window = statements.window( ghosts );
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    if( is_thread_parallel() ){
+      const structured::IntVec split = nebo_find_partition( window.extent(), statements.partition_count() );
+      const int max = nebo_partition_count( split );
+      const typename Statements::ResizeType resized = statements.resize( ghosts );
+      NeboParallelRegion * const region = NeboParallelRegion::current();
+      CountdownLatch latch( max );
+      CountdownLatch * const done = ( region ? region->begin_statement( split, window, NeboReadsNeighbors<Statements>::result, max ) : &latch );
+      structured::IntVec location(0,0,0);
+      for( int count=0; count<max; ++count ){
+        ThreadPoolAffine::Task const task = boost::bind( &nebo_fused_partition<typename Statements::ResizeType>,
+                                                         resized, window, split, location, done );
+        if( region ) ThreadPoolAffine::self().schedule( count, task );
+        else{
+#         ifdef NEBO_NUMA
+          ThreadPoolAffine::self().schedule( count, task );
+#         else
+          ThreadPoolFIFO::self().schedule( task );
+#         endif
+        }
+        location = nebo_next_partition( location, split );
+      }
+      if( !region ) latch.wait();
+      return;
+    }
+#   endif
+
+#   ifdef NEBO_SIMD
+    nebo_fused_simd_walk( statements.simd_init( ghosts ), window.extent() );
+#   else
+    nebo_fused_walk( statements.init( ghosts ), window.extent() );
+#   endif
+  }
+
+  //------------------------------------------------------------------
+
+  /**
+   * @brief The statement <tt>lhs <<= rhs</tt>, to be run by nebo_fused_assign
+   */
+  template<typename RhsType, typename FieldType>
+  inline NeboStatement<RhsType,FieldType>
+  nebo_statement( FieldType& lhs, const NeboExpression<RhsType,FieldType>& rhs ){
+    return NeboStatement<RhsType,FieldType>( lhs, rhs.expr() );
+  }
+
+  template<typename FieldType>
+  inline NeboStatement<NeboConstField<Initial,FieldType>,FieldType>
+  nebo_statement( FieldType& lhs, const FieldType& rhs ){
+    return NeboStatement<NeboConstField<Initial,FieldType>,FieldType>( lhs, NeboConstField<Initial,FieldType>(rhs) );
+  }
+
+  template<typename FieldType>
+  inline NeboStatement<NeboScalar<Initial,typename FieldType::value_type>,FieldType>
+  nebo_statement( FieldType& lhs, const typename FieldType::value_type& rhs ){
+    return NeboStatement<NeboScalar<Initial,typename FieldType::value_type>,FieldType>( lhs, NeboScalar<Initial,typename FieldType::value_type>(rhs) );
+  }
+
+  /**
+   * @brief Run the given statements (see nebo_statement) in one traversal
+   *  of their common window.
+   */
+  template<typename S1, typename S2>
+  inline void nebo_fused_assign( const S1& s1, const S2& s2 ){
+    nebo_fused_assign_statements( NeboFusedStatements<S1,S2>( s1, s2 ) );
+  }
+
+  template<typename S1, typename S2, typename S3>
+  inline void nebo_fused_assign( const S1& s1, const S2& s2, const S3& s3 ){
+    nebo_fused_assign_statements( NeboFusedStatements<S1,NeboFusedStatements<S2,S3> >( s1, NeboFusedStatements<S2,S3>( s2, s3 ) ) );
+  }
+
+  template<typename S1, typename S2, typename S3, typename S4>
+  inline void nebo_fused_assign( const S1& s1, const S2& s2, const S3& s3, const S4& s4 ){
+    nebo_fused_assign_statements( NeboFusedStatements<S1,NeboFusedStatements<S2,NeboFusedStatements<S3,S4> > >
+                                  ( s1, NeboFusedStatements<S2,NeboFusedStatements<S3,S4> >( s2, NeboFusedStatements<S3,S4>( s3, s4 ) ) ) );
+  }
+
+} // namespace SpatialOps
+
+#endif // Nebo_FusedAssignment_h
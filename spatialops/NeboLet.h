@@ -0,0 +1,611 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_Let_h
+#define Nebo_Let_h
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/shared_ptr.hpp>
+#ifdef FIELD_EXPRESSION_THREADS
+#  include <boost/thread/recursive_mutex.hpp>
+#endif
+
+#include <spatialops/NeboBasic.h>
+#include <spatialops/NeboRhs.h>
+
+/**
+ * \file NeboLet.h
+ *
+ * Named subexpressions: nebo_let binds the value of an expression to a
+ * NeboVariable, which the body of the let can then use any number of times,
+ * e.g.
+ *
+ * \code
+ *   NeboVariable<SVolField> k;
+ *   rate <<= nebo_let( k, exp( -Ea / T ),
+ *                      k * y1 * y2 - k / keq * y3 );
+ * \endcode
+ *
+ * evaluates <tt>exp(-Ea/T)</tt> once per point rather than twice.  Lets
+ * work in every CPU mode (sequential, SIMD, threaded and reductions) and
+ * can be nested; a let of a variable that is already bound shadows the
+ * outer binding within its body.
+ *
+ * A variable is the value of its expression at the point being evaluated,
+ * so it cannot be shifted: applying a stencil to a variable (rather than to
+ * the whole let) throws an exception when the expression is evaluated, as
+ * does using a variable outside of a let that binds it.  Lets do not run on
+ * the GPU.
+ */
+
+namespace SpatialOps{
+
+  /**
+   * @struct NeboLetSlot
+   * @brief Where a let stores the value of its expression at the current
+   *  point for its variable to read.  Each walk of a let has its own slot.
+   */
+  template<typename ValueType>
+  struct NeboLetSlot{
+    ValueType value;
+#   ifdef NEBO_SIMD
+    // a pack, as bytes: new does not align slots for packs
+    unsigned char pack[ sizeof(typename NeboSIMDPack<ValueType>::type) ];
+#   endif
+  };
+
+  /**
+   * @struct NeboLetBinding
+   * @brief Shared by a NeboVariable and the lets that bind it: while a let
+   *  builds its walk, \c slot is the slot of that walk, which the uses of the
+   *  variable in the body pick up.
+   *
+   * Walks of the same expression may be built on several threads at once
+   * (one per partition), so the binding is locked while a let builds one.
+   */
+  template<typename ValueType>
+  struct NeboLetBinding{
+    NeboLetSlot<ValueType>* slot;
+    structured::IntVec shift;
+#   ifdef FIELD_EXPRESSION_THREADS
+    mutable boost::recursive_mutex mutex;
+#   endif
+
+    NeboLetBinding() : slot(NULL), shift(0,0,0) {}
+  };
+
+  /**
+   * @class NeboLetScope
+   * @brief Binds a variable to a new slot for as long as it exists (while a
+   *  let builds the walk of its body)
+   */
+  template<typename ValueType>
+  class NeboLetScope{
+  public:
+    NeboLetScope( NeboLetBinding<ValueType>& binding, const structured::IntVec& shift )
+      : binding_( binding ),
+#       ifdef FIELD_EXPRESSION_THREADS
+        lock_( binding.mutex ),
+#       endif
+        slot_( new NeboLetSlot<ValueType>() ),
+        outerSlot_( binding.slot ),
+        outerShift_( binding.shift )
+    {
+      binding_.slot = slot_.get();
+      binding_.shift = shift;
+    }
+
+    ~NeboLetScope(){
+      binding_.slot = outerSlot_;
+      binding_.shift = outerShift_;
+    }
+
+    inline const boost::shared_ptr< NeboLetSlot<ValueType> >& slot() const{ return slot_; }
+
+  private:
+    NeboLetBinding<ValueType>& binding_;
+#   ifdef FIELD_EXPRESSION_THREADS
+    const boost::recursive_mutex::scoped_lock lock_;
+#   endif
+    const boost::shared_ptr< NeboLetSlot<ValueType> > slot_;
+    NeboLetSlot<ValueType>* const outerSlot_;
+    const structured::IntVec outerShift_;
+  };
+
+  /**
+   * @brief The slot that a use of a variable, shifted by \c shift, reads
+   */
+  template<typename ValueType>
+  inline NeboLetSlot<ValueType>* nebo_let_slot( const NeboLetBinding<ValueType>& binding,
+                                                const structured::IntVec& shift )
+  {
+#   ifdef FIELD_EXPRESSION_THREADS
+    const boost::recursive_mutex::scoped_lock lock( binding.mutex );
+#   endif
+    if( binding.slot == NULL ){
+      std::ostringstream msg;
+      msg << "Nebo error in " << "Nebo Let" << ":\n";
+      msg << "variable used outside of a nebo_let that binds it";
+      msg << "\n";
+      msg << "\t - " << __FILE__ << " : " << __LINE__;
+      throw(std::runtime_error(msg.str()));
+    }
+    if( shift != binding.shift ){
+      std::ostringstream msg;
+      msg << "Nebo error in " << "Nebo Let" << ":\n";
+      msg << "variable shifted by a stencil (apply the stencil to the whole nebo_let instead)";
+      msg << "\n";
+      msg << "\t - " << __FILE__ << " : " << __LINE__;
+      throw(std::runtime_error(msg.str()));
+    }
+    return binding.slot;
+  }
+
+  //==================================================================
+  // NeboLetVariable: a use of a variable
+
+  template<typename CurrentMode, typename ValueType>
+  struct NeboLetVariable;
+
+  template<typename ValueType>
+  struct NeboLetVariable<Initial, ValueType>{
+  public:
+    NeboLetVariable<SeqWalk, ValueType> typedef SeqWalkType;
+#   ifdef FIELD_EXPRESSION_THREADS
+    NeboLetVariable<Resize, ValueType> typedef ResizeType;
+#   endif
+#   ifdef __CUDACC__
+    NeboLetVariable<GPUWalk, ValueType> typedef GPUWalkType;
+#   endif
+#   ifdef NEBO_SIMD
+    NeboLetVariable<SIMDWalk, ValueType> typedef SIMDWalkType;
+#   endif
+    NeboLetVariable<Reduction, ValueType> typedef ReductionType;
+
+    NeboLetVariable( const boost::shared_ptr< NeboLetBinding<ValueType> >& binding )
+      : binding_( binding )
+    {}
+
+    inline structured::GhostData possible_ghosts() const{ return structured::GhostData(GHOST_MAX); }
+
+    inline structured::IntVec extent( const structured::IntVec& minus,
+                                      const structured::IntVec& plus ) const{
+      return structured::IntVec(0,0,0);
+    }
+
+    inline SeqWalkType init( const structured::IntVec& minus,
+                             const structured::IntVec& plus,
+                             const structured::IntVec& shift ) const{
+      return SeqWalkType( nebo_let_slot( *binding_, shift ) );
+    }
+
+#   ifdef NEBO_SIMD
+    inline SIMDWalkType simd_init( const structured::IntVec& minus,
+                                   const structured::IntVec& plus,
+                                   const structured::IntVec& shift ) const{
+      return SIMDWalkType( nebo_let_slot( *binding_, shift ) );
+    }
+#   endif
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    // checked here, in the calling thread, rather than in the thread pool
+    inline ResizeType resize( const structured::IntVec& minus,
+                              const structured::IntVec& plus ) const{
+      nebo_let_slot( *binding_, binding_->shift );
+      return ResizeType( binding_ );
+    }
+#   endif
+
+#   ifdef __CUDACC__
+    inline bool cpu_ready() const{ return true; }
+    inline bool gpu_ready( const int deviceIndex ) const{ return false; }
+    inline GPUWalkType gpu_init( const structured::IntVec& minus,
+                                 const structured::IntVec& plus,
+                                 const structured::IntVec& shift,
+                                 const int deviceIndex ) const{
+      std::ostringstream msg;
+      msg << "Nebo error in " << "Nebo Let" << ":\n";
+      msg << "nebo_let does not run on the GPU";
+      msg << "\n";
+      msg << "\t - " << __FILE__ << " : " << __LINE__;
+      throw(std::runtime_error(msg.str()));
+    }
+#   ifdef NEBO_GPU_TEST
+    inline void gpu_prep( const int deviceIndex ) const{}
+#   endif
+#   endif
+
+    inline ReductionType reduce_init( const structured::IntVec& minus,
+                                      const structured::IntVec& plus,
+                                      const structured::IntVec& shift ) const{
+      return ReductionType( nebo_let_slot( *binding_, shift ) );
+    }
+
+    inline const boost::shared_ptr< NeboLetBinding<ValueType> >& binding() const{ return binding_; }
+
+  private:
+    const boost::shared_ptr< NeboLetBinding<ValueType> > binding_;
+  };
+
+# ifdef FIELD_EXPRESSION_THREADS
+  template<typename ValueType>
+  struct NeboLetVariable<Resize, ValueType>{
+  public:
+    NeboLetVariable<SeqWalk, ValueType> typedef SeqWalkType;
+
+    NeboLetVariable( const boost::shared_ptr< NeboLetBinding<ValueType> >& binding )
+      : binding_( binding )
+    {}
+
+    inline SeqWalkType init( const structured::IntVec& shift,
+                             const structured::IntVec& split,
+                             const structured::IntVec& location ) const{
+      return SeqWalkType( nebo_let_slot( *binding_, shift ) );
+    }
+
+  private:
+    const boost::shared_ptr< NeboLetBinding<ValueType> > binding_;
+  };
+# endif // FIELD_EXPRESSION_THREADS
+
+  template<typename ValueType>
+  struct NeboLetVariable<SeqWalk, ValueType>{
+  public:
+    ValueType typedef value_type;
+
+    NeboLetVariable( const NeboLetSlot<ValueType>* const slot ) : slot_( slot ) {}
+
+    inline value_type eval( const int x, const int y, const int z ) const{ return slot_->value; }
+
+  private:
+    const NeboLetSlot<ValueType>* const slot_;
+  };
+
+# ifdef NEBO_SIMD
+  template<typename ValueType>
+  struct NeboLetVariable<SIMDWalk, ValueType>{
+  public:
+    ValueType typedef value_type;
+    typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+    NeboLetVariable( const NeboLetSlot<ValueType>* const slot ) : slot_( slot ) {}
+
+    inline value_type eval( const int x, const int y, const int z ) const{ return slot_->value; }
+
+    inline pack_type pack_eval( const int x, const int y, const int z ) const{
+      pack_type pack;
+      std::memcpy( &pack, slot_->pack, sizeof(pack) );
+      return pack;
+    }
+
+  private:
+    const NeboLetSlot<ValueType>* const slot_;
+  };
+# endif // NEBO_SIMD
+
+# ifdef __CUDACC__
+  /* never built: gpu_ready is false and gpu_init throws */
+  template<typename ValueType>
+  struct NeboLetVariable<GPUWalk, ValueType>{
+  public:
+    ValueType typedef value_type;
+    __device__ inline void start( int x, int y ){}
+    __device__ inline void next(){}
+    __device__ inline value_type eval() const{ return value_type(); }
+  };
+# endif // __CUDACC__
+
+  template<typename ValueType>
+  struct NeboLetVariable<Reduction, ValueType>{
+  public:
+    ValueType typedef value_type;
+
+    NeboLetVariable( const NeboLetSlot<ValueType>* const slot ) : slot_( slot ) {}
+
+    inline void next(){}
+    inline bool at_end() const{ return false; }
+    inline bool has_length() const{ return false; }
+    inline value_type eval() const{ return slot_->value; }
+
+  private:
+    const NeboLetSlot<ValueType>* const slot_;
+  };
+
+  //==================================================================
+  // NeboLet: binds the value of Value to a variable within Body
+
+  template<typename CurrentMode, typename Value, typename Body>
+  struct NeboLet;
+
+  template<typename Value, typename Body>
+  struct NeboLet<Initial, Value, Body>{
+  public:
+    NeboLet<SeqWalk, typename Value::SeqWalkType, typename Body::SeqWalkType> typedef SeqWalkType;
+#   ifdef FIELD_EXPRESSION_THREADS
+    NeboLet<Resize, typename Value::ResizeType, typename Body::ResizeType> typedef ResizeType;
+#   endif
+#   ifdef __CUDACC__
+    NeboLet<GPUWalk, typename Value::GPUWalkType, typename Body::GPUWalkType> typedef GPUWalkType;
+#   endif
+#   ifdef NEBO_SIMD
+    NeboLet<SIMDWalk, typename Value::SIMDWalkType, typename Body::SIMDWalkType> typedef SIMDWalkType;
+#   endif
+    NeboLet<Reduction, typename Value::ReductionType, typename Body::ReductionType> typedef ReductionType;
+
+    typename Value::SeqWalkType::value_type typedef bound_type;
+    NeboLetBinding<bound_type> typedef Binding;
+
+    NeboLet( const boost::shared_ptr<Binding>& binding, const Value& value, const Body& body )
+      : binding_( binding ), value_( value ), body_( body )
+    {}
+
+    inline structured::GhostData possible_ghosts() const{
+      return min( value_.possible_ghosts(), body_.possible_ghosts() );
+    }
+
+    inline structured::IntVec extent( const structured::IntVec& minus,
+                                      const structured::IntVec& plus ) const{
+      return max( value_.extent(minus,plus), body_.extent(minus,plus) );
+    }
+
+    // the value is built outside of the scope: it sees any outer binding
+    inline SeqWalkType init( const structured::IntVec& minus,
+                             const structured::IntVec& plus,
+                             const structured::IntVec& shift ) const{
+      const typename Value::SeqWalkType value = value_.init( minus, plus, shift );
+      const NeboLetScope<bound_type> scope( *binding_, shift );
+      return SeqWalkType( scope.slot(), value, body_.init( minus, plus, shift ) );
+    }
+
+#   ifdef NEBO_SIMD
+    inline SIMDWalkType simd_init( const structured::IntVec& minus,
+                                   const structured::IntVec& plus,
+                                   const structured::IntVec& shift ) const{
+      const typename Value::SIMDWalkType value = value_.simd_init( minus, plus, shift );
+      const NeboLetScope<bound_type> scope( *binding_, shift );
+      return SIMDWalkType( scope.slot(), value, body_.simd_init( minus, plus, shift ) );
+    }
+#   endif
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    // builds a walk first, so that misused variables throw in the calling
+    // thread rather than in the thread pool
+    inline ResizeType resize( const structured::IntVec& minus,
+                              const structured::IntVec& plus ) const{
+      init( minus, plus, structured::IntVec(0,0,0) );
+      const typename Value::ResizeType value = value_.resize( minus, plus );
+      const NeboLetScope<bound_type> scope( *binding_, structured::IntVec(0,0,0) );
+      return ResizeType( binding_, value, body_.resize( minus, plus ) );
+    }
+#   endif
+
+#   ifdef __CUDACC__
+    inline bool cpu_ready() const{ return value_.cpu_ready() && body_.cpu_ready(); }
+    inline bool gpu_ready( const int deviceIndex ) const{ return false; }
+    inline GPUWalkType gpu_init( const structured::IntVec& minus,
+                                 const structured::IntVec& plus,
+                                 const structured::IntVec& shift,
+                                 const int deviceIndex ) const{
+      std::ostringstream msg;
+      msg << "Nebo error in " << "Nebo Let" << ":\n";
+      msg << "nebo_let does not run on the GPU";
+      msg << "\n";
+      msg << "\t - " << __FILE__ << " : " << __LINE__;
+      throw(std::runtime_error(msg.str()));
+    }
+#   ifdef NEBO_GPU_TEST
+    inline void gpu_prep( const int deviceIndex ) const{
+      value_.gpu_prep(deviceIndex);
+      body_.gpu_prep(deviceIndex);
+    }
+#   endif
+#   endif
+
+    inline ReductionType reduce_init( const structured::IntVec& minus,
+                                      const structured::IntVec& plus,
+                                      const structured::IntVec& shift ) const{
+      const typename Value::ReductionType value = value_.reduce_init( minus, plus, shift );
+      const NeboLetScope<bound_type> scope( *binding_, shift );
+      return ReductionType( scope.slot(), value, body_.reduce_init( minus, plus, shift ) );
+    }
+
+  private:
+    const boost::shared_ptr<Binding> binding_;
+    const Value value_;
+    const Body body_;
+  };
+
+# ifdef FIELD_EXPRESSION_THREADS
+  template<typename Value, typename Body>
+  struct NeboLet<Resize, Value, Body>{
+  public:
+    NeboLet<SeqWalk, typename Value::SeqWalkType, typename Body::SeqWalkType> typedef SeqWalkType;
+    typename Value::SeqWalkType::value_type typedef bound_type;
+    NeboLetBinding<bound_type> typedef Binding;
+
+    NeboLet( const boost::shared_ptr<Binding>& binding, const Value& value, const Body& body )
+      : binding_( binding ), value_( value ), body_( body )
+    {}
+
+    inline SeqWalkType init( const structured::IntVec& shift,
+                             const structured::IntVec& split,
+                             const structured::IntVec& location ) const{
+      const typename Value::SeqWalkType value = value_.init( shift, split, location );
+      const NeboLetScope<bound_type> scope( *binding_, shift );
+      return SeqWalkType( scope.slot(), value, body_.init( shift, split, location ) );
+    }
+
+  private:
+    const boost::shared_ptr<Binding> binding_;
+    const Value value_;
+    const Body body_;
+  };
+# endif // FIELD_EXPRESSION_THREADS
+
+  template<typename Value, typename Body>
+  struct NeboLet<SeqWalk, Value, Body>{
+  public:
+    typename Body::value_type typedef value_type;
+    NeboLetSlot<typename Value::value_type> typedef Slot;
+
+    NeboLet( const boost::shared_ptr<Slot>& slot, const Value& value, const Body& body )
+      : slot_( slot ), value_( value ), body_( body )
+    {}
+
+    inline value_type eval( const int x, const int y, const int z ) const{
+      slot_->value = value_.eval(x,y,z);
+      return body_.eval(x,y,z);
+    }
+
+  private:
+    boost::shared_ptr<Slot> slot_;
+    Value value_;
+    Body body_;
+  };
+
+# ifdef NEBO_SIMD
+  template<typename Value, typename Body>
+  struct NeboLet<SIMDWalk, Value, Body>{
+  public:
+    typename Body::value_type typedef value_type;
+    typename NeboSIMDPack<value_type>::type typedef pack_type;
+    NeboLetSlot<typename Value::value_type> typedef Slot;
+
+    NeboLet( const boost::shared_ptr<Slot>& slot, const Value& value, const Body& body )
+      : slot_( slot ), value_( value ), body_( body )
+    {}
+
+    inline value_type eval( const int x, const int y, const int z ) const{
+      slot_->value = value_.eval(x,y,z);
+      return body_.eval(x,y,z);
+    }
+
+    inline pack_type pack_eval( const int x, const int y, const int z ) const{
+      const typename Value::pack_type value = value_.pack_eval(x,y,z);
+      std::memcpy( slot_->pack, &value, sizeof(value) );
+      return body_.pack_eval(x,y,z);
+    }
+
+  private:
+    boost::shared_ptr<Slot> slot_;
+    Value value_;
+    Body body_;
+  };
+# endif // NEBO_SIMD
+
+# ifdef __CUDACC__
+  /* never built: gpu_ready is false and gpu_init throws */
+  template<typename Value, typename Body>
+  struct NeboLet<GPUWalk, Value, Body>{
+  public:
+    typename Body::value_type typedef value_type;
+    __device__ inline void start( int x, int y ){}
+    __device__ inline void next(){}
+    __device__ inline value_type eval() const{ return value_type(); }
+  };
+# endif // __CUDACC__
+
+  template<typename Value, typename Body>
+  struct NeboLet<Reduction, Value, Body>{
+  public:
+    typename Body::value_type typedef value_type;
+    NeboLetSlot<typename Value::value_type> typedef Slot;
+
+    NeboLet( const boost::shared_ptr<Slot>& slot, const Value& value, const Body& body )
+      : slot_( slot ), value_( value ), body_( body )
+    {}
+
+    inline void next(){ value_.next(); body_.next(); }
+    inline bool at_end() const{ return value_.at_end() || body_.at_end(); }
+    inline bool has_length() const{ return value_.has_length() || body_.has_length(); }
+
+    inline value_type eval() const{
+      slot_->value = value_.eval();
+      return body_.eval();
+    }
+
+  private:
+    boost::shared_ptr<Slot> slot_;
+    Value value_;
+    Body body_;
+  };
+
+  //==================================================================
+  // user interface
+
+  /**
+   * @struct NeboVariable
+   * @brief A variable that nebo_let binds to the value of an expression.
+   *  A variable is a Nebo expression on fields of type \c FieldType.
+   *
+   * Copies of a variable are the same variable.
+   */
+  template<typename FieldType>
+  struct NeboVariable
+    : public NeboExpression< NeboLetVariable<Initial, typename FieldType::value_type>, FieldType >
+  {
+    typename FieldType::value_type typedef value_type;
+    NeboLetVariable<Initial, value_type> typedef Expr;
+    NeboLetBinding<value_type> typedef Binding;
+
+    NeboVariable()
+      : NeboExpression<Expr,FieldType>( Expr( boost::shared_ptr<Binding>( new Binding() ) ) )
+    {}
+
+    inline const boost::shared_ptr<Binding>& binding() const{ return this->expr().binding(); }
+  };
+
+  /**
+   * @brief The expression \c body, in which \c var has the value of \c value
+   *  at each point.  \c value is evaluated once per point, however often
+   *  \c body uses \c var.
+   */
+  template<typename Value, typename Body, typename FieldType>
+  inline NeboExpression< NeboLet<Initial, Value, Body>, FieldType >
+  nebo_let( const NeboVariable<FieldType>& var,
+            const NeboExpression<Value,FieldType>& value,
+            const NeboExpression<Body,FieldType>& body )
+  {
+    NeboLet<Initial, Value, Body> typedef ReturnType;
+    NeboExpression<ReturnType, FieldType> typedef ReturnTerm;
+    return ReturnTerm( ReturnType( var.binding(), value.expr(), body.expr() ) );
+  }
+
+  /**
+   * @brief The expression \c body, in which \c var has the value of the
+   *  field \c value at each point
+   */
+  template<typename Body, typename FieldType>
+  inline NeboExpression< NeboLet<Initial, NeboConstField<Initial,FieldType>, Body>, FieldType >
+  nebo_let( const NeboVariable<FieldType>& var,
+            const FieldType& value,
+            const NeboExpression<Body,FieldType>& body )
+  {
+    return nebo_let( var, NeboExpression<NeboConstField<Initial,FieldType>,FieldType>( NeboConstField<Initial,FieldType>(value) ), body );
+  }
+
+} // namespace SpatialOps
+
+#endif // Nebo_Let_h
@@ -53,6 +53,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboField<SIMDWalk, FieldType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboField<Reduction, FieldType> typedef ReductionType;
 
           NeboField(FieldType f)
@@ -148,12 +153,22 @@
               structured::GhostData lhs_ghosts = calculate_valid_lhs_ghost(rhs_ghosts,
                                                                            field_.boundary_info());
 
-              init(lhs_ghosts.get_minus(), lhs_ghosts.get_plus()).assign(rhs.init(rhs_ghosts.get_minus(),
-                                                                                  rhs_ghosts.get_plus(),
-                                                                                  structured::
-                                                                                  IntVec(0,
-                                                                                         0,
-                                                                                         0)));
+              #ifdef NEBO_SIMD
+                 simd_init(lhs_ghosts.get_minus(), lhs_ghosts.get_plus()).assign(rhs.simd_init(rhs_ghosts.get_minus(),
+                                                                                               rhs_ghosts.get_plus(),
+                                                                                               structured::
+                                                                                               IntVec(0,
+                                                                                                      0,
+                                                                                                      0)))
+              #else
+                 init(lhs_ghosts.get_minus(), lhs_ghosts.get_plus()).assign(rhs.init(rhs_ghosts.get_minus(),
+                                                                                     rhs_ghosts.get_plus(),
+                                                                                     structured::
+                                                                                     IntVec(0,
+                                                                                            0,
+                                                                                            0)))
+              #endif
+              /* NEBO_SIMD */;
 
               #ifdef NEBO_REPORT_BACKEND
                  std::cout << "Finished Nebo sequential" << std::endl
@@ -168,6 +183,16 @@
                                  field_));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) {
+                return SIMDWalkType((field_.reset_valid_ghosts(structured::GhostData(minus,
+                                                                                     plus)),
+                                     field_));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              template<typename RhsType>
               inline void thread_parallel_assign(bool const useGhost,
@@ -177,8 +202,6 @@
                  #endif
                  /* NEBO_REPORT_BACKEND */;
 
-                 Semaphore semaphore(0);
-
                  const int thread_count = field_.get_partition_count();
 
                  structured::GhostData rhs_ghosts = calculate_valid_ghost(useGhost,
@@ -191,9 +214,11 @@
 
                  typename RhsType::ResizeType typedef RhsResizeType;
 
-                 const structured::IntVec split = nebo_find_partition(resize_ghost(field_,
-                                                                                   lhs_ghosts.get_minus(),
-                                                                                   lhs_ghosts.get_plus()).window_with_ghost().extent(),
+                 const structured::MemoryWindow window = resize_ghost(field_,
+                                                                      lhs_ghosts.get_minus(),
+                                                                      lhs_ghosts.get_plus()).window_with_ghost();
+
+                 const structured::IntVec split = nebo_find_partition(window.extent(),
                                                                       thread_count);
 
                  const int max = nebo_partition_count(split);
@@ -203,21 +228,42 @@
                  RhsResizeType new_rhs = rhs.resize(rhs_ghosts.get_minus(),
                                                     rhs_ghosts.get_plus());
 
+                 NeboParallelRegion * const region = NeboParallelRegion::current();
+
+                 CountdownLatch latch(max);
+
+                 CountdownLatch * const done = (region ? region->begin_statement(split,
+                                                                                window,
+                                                                                NeboReadsNeighbors<RhsType>::
+                                                                                result,
+                                                                                max) : &latch);
+
                  structured::IntVec location = structured::IntVec(0, 0, 0);
 
                  for(int count = 0; count < max; count++) {
-                    ThreadPoolFIFO::self().schedule(boost::bind(&ResizeType::
-                                                                template assign<RhsResizeType>,
-                                                                new_lhs,
-                                                                new_rhs,
-                                                                split,
-                                                                location,
-                                                                &semaphore));
+                    ThreadPoolAffine::Task const task = boost::bind(&ResizeType::
+                                                                    template
+                                                                    assign<RhsResizeType>,
+                                                                    new_lhs,
+                                                                    new_rhs,
+                                                                    split,
+                                                                    location,
+                                                                    done);
+
+                    if(region) { ThreadPoolAffine::self().schedule(count, task); }
+                    else {
+                       #ifdef NEBO_NUMA
+                          ThreadPoolAffine::self().schedule(count, task)
+                       #else
+                          ThreadPoolFIFO::self().schedule(task)
+                       #endif
+                       /* NEBO_NUMA */;
+                    };
 
                     location = nebo_next_partition(location, split);
                  };
 
-                 for(int ii = 0; ii < max; ii++) { semaphore.wait(); };
+                 if(!(region)) { latch.wait(); };
 
                  #ifdef NEBO_REPORT_BACKEND
                     std::cout << "Finished Nebo thread parallel" << std::endl
@@ -403,14 +449,14 @@
                  inline void assign(RhsType const & rhs,
                                     structured::IntVec const & split,
                                     structured::IntVec const & location,
-                                    Semaphore * semaphore) {
+                                    CountdownLatch * latch) {
                     init(split, location).assign(rhs.init(structured::IntVec(0,
                                                                              0,
                                                                              0),
                                                           split,
                                                           location));
 
-                    semaphore->post();
+                    latch->count_down();
                  }
              #endif
              /* FIELD_EXPRESSION_THREADS */
@@ -435,27 +481,110 @@
           typename field_type::value_type typedef value_type;
 
           NeboField(FieldType f)
-          : iter_(f.begin()), end_(f.end())
+          : base_(f.field_values(LOCAL_RAM) + f.window_with_ghost().offset(0)
+                  + f.window_with_ghost().glob_dim(0) * (f.window_with_ghost().offset(1)
+                                                         + (f.window_with_ghost().glob_dim(1)
+                                                            * f.window_with_ghost().offset(2)))),
+            xGlob_(f.window_with_ghost().glob_dim(0)),
+            yGlob_(f.window_with_ghost().glob_dim(1)),
+            xExtent_(f.window_with_ghost().extent(0)),
+            yExtent_(f.window_with_ghost().extent(1)),
+            zExtent_(f.window_with_ghost().extent(2))
           {}
 
           template<typename RhsType>
-           inline void assign(RhsType rhs) {
-              while(!at_end()) { ref() = rhs.eval(); next(); rhs.next(); };
+           inline void assign(RhsType const & rhs) {
+              int const yTile = nebo_tile_rows<RhsType, value_type>(xExtent_, yExtent_);
+
+              for(int yStart = 0; yStart < yExtent_; yStart += yTile) {
+                 int const yEnd = (yStart + yTile < yExtent_ ? yStart + yTile : yExtent_);
+
+                 for(int z = 0; z < zExtent_; z++) {
+                    for(int y = yStart; y < yEnd; y++) {
+                       value_type * const row = base_ + xGlob_ * (y + (yGlob_ * z));
+
+                       for(int x = 0; x < xExtent_; x++) { row[x] = rhs.eval(x, y, z); };
+                    };
+                 };
+              };
            }
 
          private:
-          inline void next(void) { iter_++; }
+          value_type * base_;
 
-          inline bool at_end(void) const { return iter_ == end_; }
+          int const xGlob_;
 
-          inline bool has_length(void) const { return true; }
+          int const yGlob_;
 
-          inline value_type & ref(void) { return *iter_; }
+          int const xExtent_;
 
-          typename FieldType::iterator iter_;
+          int const yExtent_;
 
-          typename FieldType::iterator const end_;
+          int const zExtent_;
       };
+      #ifdef NEBO_SIMD
+         template<typename FieldType>
+          struct NeboField<SIMDWalk, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             NeboField(FieldType f)
+             : base_(f.field_values(LOCAL_RAM) + f.window_with_ghost().offset(0)
+                     + f.window_with_ghost().glob_dim(0) * (f.window_with_ghost().offset(1)
+                                                            + (f.window_with_ghost().glob_dim(1)
+                                                               * f.window_with_ghost().offset(2)))),
+               xGlob_(f.window_with_ghost().glob_dim(0)),
+               yGlob_(f.window_with_ghost().glob_dim(1)),
+               xExtent_(f.window_with_ghost().extent(0)),
+               yExtent_(f.window_with_ghost().extent(1)),
+               zExtent_(f.window_with_ghost().extent(2)),
+               xPacked_(NeboSIMDPack<value_type>::vectorized ? xExtent_ - (xExtent_
+                                                                          % NEBO_SIMD_WIDTH) : 0)
+             {}
+
+             template<typename RhsType>
+              inline void assign(RhsType const & rhs) {
+                 int const yTile = nebo_tile_rows<RhsType, value_type>(xExtent_, yExtent_);
+
+                 for(int yStart = 0; yStart < yExtent_; yStart += yTile) {
+                    int const yEnd = (yStart + yTile < yExtent_ ? yStart + yTile : yExtent_);
+
+                    for(int z = 0; z < zExtent_; z++) {
+                       for(int y = yStart; y < yEnd; y++) {
+                          value_type * const row = base_ + xGlob_ * (y + (yGlob_ * z));
+
+                          int x = 0;
+
+                          for(; x < xPacked_; x += NEBO_SIMD_WIDTH) {
+                             NeboSIMDPack<value_type>::store(row + x,
+                                                             rhs.pack_eval(x, y, z));
+                          };
+
+                          for(; x < xExtent_; x++) { row[x] = rhs.eval(x, y, z); };
+                       };
+                    };
+                 };
+              }
+
+            private:
+             value_type * base_;
+
+             int const xGlob_;
+
+             int const yGlob_;
+
+             int const xExtent_;
+
+             int const yExtent_;
+
+             int const zExtent_;
+
+             int const xPacked_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename FieldType>
           struct NeboField<GPUWalk, FieldType> {
@@ -45,6 +45,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboMask<SIMDWalk, FieldType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboMask<Reduction, FieldType> typedef ReductionType;
 
           NeboMask(structured::SpatialMask<FieldType> const & m)
@@ -55,6 +60,12 @@
              return mask_.get_valid_ghost_data() + point_to_ghost(mask_.boundary_info().has_extra());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return resize_ghost(mask_, minus, plus - mask_.boundary_info().has_extra())
+                    .window_with_ghost().extent();
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -64,6 +75,18 @@
                                                               shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(resize_ghost_and_shift_window(mask_,
+                                                                  minus,
+                                                                  plus - mask_.boundary_info().has_extra(),
+                                                                  shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -148,16 +171,83 @@
           typename field_type::value_type typedef value_type;
 
           NeboMask(structured::SpatialMask<FieldType> const & m)
-          : iter_(m.begin())
+          : bitField_(m.mask_values(LOCAL_RAM)),
+            offset_(m.window_with_ghost().offset(0) + m.window_with_ghost().glob_dim(0)
+                    * (m.window_with_ghost().offset(1) + (m.window_with_ghost().glob_dim(1)
+                                                           * m.window_with_ghost().offset(2)))),
+            xGlob_(m.window_with_ghost().glob_dim(0)),
+            yGlob_(m.window_with_ghost().glob_dim(1))
           {}
 
-          inline void next(void) { iter_++; }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return !(!(*(bitField_ + (position(x, y, z) / NEBO_INT_BIT))
+                        & (1 << (position(x, y, z) % NEBO_INT_BIT))));
+          }
 
-          inline value_type eval(void) const { return *iter_; }
+          inline int position(int const x, int const y, int const z) const {
+             return offset_ + x + xGlob_ * (y + (yGlob_ * z));
+          }
 
          private:
-          typename structured::SpatialMask<FieldType>::const_iterator iter_;
+          unsigned int const * bitField_;
+
+          int const offset_;
+
+          int const xGlob_;
+
+          int const yGlob_;
       };
+      #ifdef NEBO_SIMD
+         template<typename FieldType>
+          struct NeboMask<SIMDWalk, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             NeboMask(structured::SpatialMask<FieldType> const & m)
+             : bitField_(m.mask_values(LOCAL_RAM)),
+               offset_(m.window_with_ghost().offset(0) + m.window_with_ghost().glob_dim(0)
+                       * (m.window_with_ghost().offset(1) + (m.window_with_ghost().glob_dim(1)
+                                                              * m.window_with_ghost().offset(2)))),
+               xGlob_(m.window_with_ghost().glob_dim(0)),
+               yGlob_(m.window_with_ghost().glob_dim(1))
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return !(!(*(bitField_ + (position(x, y, z) / NEBO_INT_BIT))
+                           & (1 << (position(x, y, z) % NEBO_INT_BIT))));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                NeboSIMDMask result;
+
+                for(int lane = 0; lane < NEBO_SIMD_WIDTH; lane++) {
+                   result[lane] = (eval(x + lane, y, z) ? -1 : 0);
+                };
+
+                return result;
+             }
+
+             inline int position(int const x, int const y, int const z) const {
+                return offset_ + x + xGlob_ * (y + (yGlob_ * z));
+             }
+
+            private:
+             unsigned int const * bitField_;
+
+             int const offset_;
+
+             int const xGlob_;
+
+             int const yGlob_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename FieldType>
           struct NeboMask<GPUWalk, FieldType> {
@@ -49,6 +49,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             SumOp<SIMDWalk,
+                   typename Operand1::SIMDWalkType,
+                   typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           SumOp<Reduction,
                 typename Operand1::ReductionType,
                 typename Operand2::ReductionType> typedef ReductionType;
@@ -61,6 +68,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -68,6 +80,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -156,10 +178,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return (operand1_.eval() + operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) + operand2_.eval(x, y, z));
           }
 
          private:
@@ -167,6 +187,38 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct SumOp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             SumOp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return (operand1_.eval(x, y, z) + operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return (operand1_.pack_eval(x, y, z) +
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct SumOp<GPUWalk, Operand1, Operand2> {
@@ -834,6 +886,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             DiffOp<SIMDWalk,
+                    typename Operand1::SIMDWalkType,
+                    typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           DiffOp<Reduction,
                  typename Operand1::ReductionType,
                  typename Operand2::ReductionType> typedef ReductionType;
@@ -846,6 +905,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -853,6 +917,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -941,10 +1015,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return (operand1_.eval() - operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) - operand2_.eval(x, y, z));
           }
 
          private:
@@ -952,6 +1024,38 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct DiffOp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             DiffOp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return (operand1_.eval(x, y, z) - operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return (operand1_.pack_eval(x, y, z) -
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct DiffOp<GPUWalk, Operand1, Operand2> {
@@ -1619,6 +1723,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             ProdOp<SIMDWalk,
+                    typename Operand1::SIMDWalkType,
+                    typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           ProdOp<Reduction,
                  typename Operand1::ReductionType,
                  typename Operand2::ReductionType> typedef ReductionType;
@@ -1631,6 +1742,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -1638,6 +1754,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -1726,10 +1852,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return (operand1_.eval() * operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) * operand2_.eval(x, y, z));
           }
 
          private:
@@ -1737,6 +1861,38 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct ProdOp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             ProdOp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return (operand1_.eval(x, y, z) * operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return (operand1_.pack_eval(x, y, z) *
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct ProdOp<GPUWalk, Operand1, Operand2> {
@@ -2404,6 +2560,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             DivOp<SIMDWalk,
+                   typename Operand1::SIMDWalkType,
+                   typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           DivOp<Reduction,
                 typename Operand1::ReductionType,
                 typename Operand2::ReductionType> typedef ReductionType;
@@ -2416,6 +2579,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -2423,6 +2591,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -2511,10 +2689,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return (operand1_.eval() / operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) / operand2_.eval(x, y, z));
           }
 
          private:
@@ -2522,6 +2698,38 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct DivOp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             DivOp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return (operand1_.eval(x, y, z) / operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return (operand1_.pack_eval(x, y, z) /
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct DivOp<GPUWalk, Operand1, Operand2> {
@@ -3183,6 +3391,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             SinFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           SinFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -3194,12 +3407,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -3273,15 +3500,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::sin(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::sin(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct SinFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             SinFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::sin(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_sin(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct SinFcn<GPUWalk, Operand> {
@@ -3407,6 +3661,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             CosFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           CosFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -3418,12 +3677,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -3497,15 +3770,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::cos(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::cos(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct CosFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             CosFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::cos(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_cos(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct CosFcn<GPUWalk, Operand> {
@@ -3631,6 +3931,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             TanFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           TanFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -3642,12 +3947,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -3721,15 +4040,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::tan(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::tan(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct TanFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             TanFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::tan(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_tan(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct TanFcn<GPUWalk, Operand> {
@@ -3855,6 +4201,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             ExpFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           ExpFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -3866,12 +4217,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -3945,15 +4310,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::exp(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::exp(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct ExpFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             ExpFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::exp(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_exp(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct ExpFcn<GPUWalk, Operand> {
@@ -4080,6 +4472,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             TanhFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType
+             ;
+          #endif
+          /* NEBO_SIMD */
+
           TanhFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -4091,15 +4489,29 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
-          #ifdef FIELD_EXPRESSION_THREADS
-             inline ResizeType resize(structured::IntVec const & minus,
-                                      structured::IntVec const & plus) const {
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
+          #ifdef FIELD_EXPRESSION_THREADS
+             inline ResizeType resize(structured::IntVec const & minus,
+                                      structured::IntVec const & plus) const {
                 return ResizeType(operand_.resize(minus, plus));
              }
           #endif
@@ -4171,15 +4583,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::tanh(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::tanh(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct TanhFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             TanhFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::tanh(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_tanh(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct TanhFcn<GPUWalk, Operand> {
@@ -4305,6 +4744,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             AbsFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           AbsFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -4316,12 +4760,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -4395,15 +4853,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::abs(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::abs(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct AbsFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             AbsFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::abs(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_abs(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct AbsFcn<GPUWalk, Operand> {
@@ -4529,6 +5014,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NegFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NegFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -4540,12 +5030,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -4619,13 +5123,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const { return -(operand_.eval()); }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return -(operand_.eval(x, y, z));
+          }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct NegFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NegFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return -(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return -(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct NegFcn<GPUWalk, Operand> {
@@ -4758,6 +5291,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             PowFcn<SIMDWalk,
+                    typename Operand1::SIMDWalkType,
+                    typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           PowFcn<Reduction,
                  typename Operand1::ReductionType,
                  typename Operand2::ReductionType> typedef ReductionType;
@@ -4770,6 +5310,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -4777,6 +5322,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -4865,10 +5420,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return std::pow(operand1_.eval(), operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::pow(operand1_.eval(x, y, z), operand2_.eval(x, y, z));
           }
 
          private:
@@ -4876,6 +5429,39 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct PowFcn<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             PowFcn(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::pow(operand1_.eval(x, y, z),
+                                operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_pow(operand1_.pack_eval(x, y, z),
+                                     operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct PowFcn<GPUWalk, Operand1, Operand2> {
@@ -5543,6 +6129,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             SqrtFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType
+             ;
+          #endif
+          /* NEBO_SIMD */
+
           SqrtFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -5554,12 +6146,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -5634,15 +6240,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::sqrt(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::sqrt(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct SqrtFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             SqrtFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::sqrt(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_sqrt(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct SqrtFcn<GPUWalk, Operand> {
@@ -5768,6 +6401,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             LogFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           LogFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -5779,12 +6417,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -5858,15 +6510,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::log(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::log(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct LogFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             LogFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::log(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_log(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct LogFcn<GPUWalk, Operand> {
@@ -5993,6 +6672,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             Log10Fcn<SIMDWalk, typename Operand::SIMDWalkType> typedef
+             SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           Log10Fcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -6004,12 +6689,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -6084,15 +6783,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const {
-             return std::log10(operand_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return std::log10(operand_.eval(x, y, z));
           }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct Log10Fcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             Log10Fcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return std::log10(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_log10(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct Log10Fcn<GPUWalk, Operand> {
@@ -6219,6 +6945,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             ErfFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           ErfFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -6230,12 +6961,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -6309,13 +7054,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const { return erf(operand_.eval()); }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return erf(operand_.eval(x, y, z));
+          }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct ErfFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             ErfFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return erf(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_erf(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct ErfFcn<GPUWalk, Operand> {
@@ -6440,6 +7214,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             ErfcFcn<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType
+             ;
+          #endif
+          /* NEBO_SIMD */
+
           ErfcFcn<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -6451,12 +7231,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -6531,13 +7325,42 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline value_type eval(void) const { return erfc(operand_.eval()); }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return erfc(operand_.eval(x, y, z));
+          }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct ErfcFcn<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             ErfcFcn(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return erfc(operand_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return nebo_simd_erfc(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct ErfcFcn<GPUWalk, Operand> {
@@ -6667,6 +7490,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             EqualCmp<SIMDWalk,
+                      typename Operand1::SIMDWalkType,
+                      typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           EqualCmp<Reduction,
                    typename Operand1::ReductionType,
                    typename Operand2::ReductionType> typedef ReductionType;
@@ -6679,6 +7509,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -6686,6 +7521,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -6774,10 +7619,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() == operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) == operand2_.eval(x, y, z));
           }
 
          private:
@@ -6785,6 +7628,34 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct EqualCmp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             EqualCmp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) == operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) ==
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct EqualCmp<GPUWalk, Operand1, Operand2> {
@@ -7530,6 +8401,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             InequalCmp<SIMDWalk,
+                        typename Operand1::SIMDWalkType,
+                        typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           InequalCmp<Reduction,
                      typename Operand1::ReductionType,
                      typename Operand2::ReductionType> typedef ReductionType;
@@ -7542,6 +8420,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -7549,6 +8432,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -7637,10 +8530,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() != operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) != operand2_.eval(x, y, z));
           }
 
          private:
@@ -7648,6 +8539,34 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct InequalCmp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             InequalCmp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) != operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) !=
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct InequalCmp<GPUWalk, Operand1, Operand2> {
@@ -8396,6 +9315,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             LessThanCmp<SIMDWalk,
+                         typename Operand1::SIMDWalkType,
+                         typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           LessThanCmp<Reduction,
                       typename Operand1::ReductionType,
                       typename Operand2::ReductionType> typedef ReductionType;
@@ -8408,6 +9334,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -8415,6 +9346,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -8503,17 +9444,43 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() < operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) < operand2_.eval(x, y, z));
           }
 
          private:
           Operand1 operand1_;
 
-          Operand2 operand2_;
-      };
+          Operand2 operand2_;
+      };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct LessThanCmp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             LessThanCmp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) < operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) <
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct LessThanCmp<GPUWalk, Operand1, Operand2> {
@@ -9245,6 +10212,14 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             LessThanEqualCmp<SIMDWalk,
+                              typename Operand1::SIMDWalkType,
+                              typename Operand2::SIMDWalkType> typedef
+             SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           LessThanEqualCmp<Reduction,
                            typename Operand1::ReductionType,
                            typename Operand2::ReductionType> typedef
@@ -9258,6 +10233,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -9265,6 +10245,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -9355,10 +10345,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() <= operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) <= operand2_.eval(x, y, z));
           }
 
          private:
@@ -9366,6 +10354,34 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct LessThanEqualCmp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             LessThanEqualCmp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) <= operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) <=
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct LessThanEqualCmp<GPUWalk, Operand1, Operand2> {
@@ -10137,6 +11153,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             GreaterThanCmp<SIMDWalk,
+                            typename Operand1::SIMDWalkType,
+                            typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           GreaterThanCmp<Reduction,
                          typename Operand1::ReductionType,
                          typename Operand2::ReductionType> typedef ReductionType
@@ -10150,6 +11173,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -10157,6 +11185,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -10245,10 +11283,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() > operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) > operand2_.eval(x, y, z));
           }
 
          private:
@@ -10256,6 +11292,34 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct GreaterThanCmp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             GreaterThanCmp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) > operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) >
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct GreaterThanCmp<GPUWalk, Operand1, Operand2> {
@@ -11000,6 +12064,14 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             GreaterThanEqualCmp<SIMDWalk,
+                                 typename Operand1::SIMDWalkType,
+                                 typename Operand2::SIMDWalkType> typedef
+             SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           GreaterThanEqualCmp<Reduction,
                               typename Operand1::ReductionType,
                               typename Operand2::ReductionType> typedef
@@ -11014,6 +12086,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -11021,6 +12098,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -11112,10 +12199,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() >= operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) >= operand2_.eval(x, y, z));
           }
 
          private:
@@ -11123,6 +12208,35 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct GreaterThanEqualCmp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             GreaterThanEqualCmp(Operand1 const & operand1,
+                                 Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) >= operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) >=
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct GreaterThanEqualCmp<GPUWalk, Operand1, Operand2> {
@@ -11905,6 +13019,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             AndOp<SIMDWalk,
+                   typename Operand1::SIMDWalkType,
+                   typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           AndOp<Reduction,
                 typename Operand1::ReductionType,
                 typename Operand2::ReductionType> typedef ReductionType;
@@ -11917,6 +13038,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -11924,6 +13050,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -12012,10 +13148,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() && operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) && operand2_.eval(x, y, z));
           }
 
          private:
@@ -12023,6 +13157,34 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct AndOp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             AndOp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) && operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) &&
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct AndOp<GPUWalk, Operand1, Operand2> {
@@ -12285,6 +13447,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             OrOp<SIMDWalk,
+                  typename Operand1::SIMDWalkType,
+                  typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           OrOp<Reduction,
                typename Operand1::ReductionType,
                typename Operand2::ReductionType> typedef ReductionType;
@@ -12297,6 +13466,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -12304,6 +13478,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -12392,10 +13576,8 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline bool eval(void) const {
-             return (operand1_.eval() || operand2_.eval());
+          inline bool eval(int const x, int const y, int const z) const {
+             return (operand1_.eval(x, y, z) || operand2_.eval(x, y, z));
           }
 
          private:
@@ -12403,6 +13585,34 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct OrOp<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             OrOp(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return (operand1_.eval(x, y, z) || operand2_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return (operand1_.pack_eval(x, y, z) ||
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct OrOp<GPUWalk, Operand1, Operand2> {
@@ -12657,6 +13867,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NotOp<SIMDWalk, typename Operand::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NotOp<Reduction, typename Operand::ReductionType> typedef
           ReductionType;
 
@@ -12668,12 +13883,26 @@
              return operand_.possible_ghosts();
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return operand_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(operand_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -12747,13 +13976,38 @@
           : operand_(operand)
           {}
 
-          inline void next(void) { operand_.next(); }
-
-          inline bool eval(void) const { return !(operand_.eval()); }
+          inline bool eval(int const x, int const y, int const z) const {
+             return !(operand_.eval(x, y, z));
+          }
 
          private:
           Operand operand_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand>
+          struct NotOp<SIMDWalk, Operand> {
+            public:
+             typename Operand::value_type typedef value_type;
+
+             NotOp(Operand const & operand)
+             : operand_(operand)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return !(operand_.eval(x, y, z));
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return !(operand_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand operand_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand>
           struct NotOp<GPUWalk, Operand> {
@@ -12851,6 +14105,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             MaxFcn<SIMDWalk,
+                    typename Operand1::SIMDWalkType,
+                    typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           MaxFcn<Reduction,
                  typename Operand1::ReductionType,
                  typename Operand2::ReductionType> typedef ReductionType;
@@ -12863,6 +14124,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -12870,6 +14136,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -12958,11 +14234,9 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return ((operand1_.eval() > operand2_.eval()) ? operand1_.eval() :
-                     operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return ((operand1_.eval(x, y, z) > operand2_.eval(x, y, z)) ?
+                     operand1_.eval(x, y, z) : operand2_.eval(x, y, z));
           }
 
          private:
@@ -12970,6 +14244,41 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct MaxFcn<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             MaxFcn(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return ((operand1_.eval(x, y, z) > operand2_.eval(x, y, z)) ?
+                        operand1_.eval(x, y, z) : operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return ((operand1_.pack_eval(x, y, z) >
+                         operand2_.pack_eval(x, y, z)) ?
+                        operand1_.pack_eval(x, y, z) :
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct MaxFcn<GPUWalk, Operand1, Operand2> {
@@ -13644,6 +14953,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             MinFcn<SIMDWalk,
+                    typename Operand1::SIMDWalkType,
+                    typename Operand2::SIMDWalkType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           MinFcn<Reduction,
                  typename Operand1::ReductionType,
                  typename Operand2::ReductionType> typedef ReductionType;
@@ -13656,6 +14972,11 @@
              return min(operand1_.possible_ghosts(), operand2_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return max(operand1_.extent(minus, plus), operand2_.extent(minus, plus));
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -13663,6 +14984,16 @@
                                 operand2_.init(minus, plus, shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(operand1_.simd_init(minus, plus, shift),
+                                    operand2_.simd_init(minus, plus, shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -13751,11 +15082,9 @@
           : operand1_(operand1), operand2_(operand2)
           {}
 
-          inline void next(void) { operand1_.next(); operand2_.next(); }
-
-          inline value_type eval(void) const {
-             return ((operand1_.eval() < operand2_.eval()) ? operand1_.eval() :
-                     operand2_.eval());
+          inline value_type eval(int const x, int const y, int const z) const {
+             return ((operand1_.eval(x, y, z) < operand2_.eval(x, y, z)) ?
+                     operand1_.eval(x, y, z) : operand2_.eval(x, y, z));
           }
 
          private:
@@ -13763,6 +15092,41 @@
 
           Operand2 operand2_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Operand1, typename Operand2>
+          struct MinFcn<SIMDWalk, Operand1, Operand2> {
+            public:
+             typename Operand1::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             MinFcn(Operand1 const & operand1, Operand2 const & operand2)
+             : operand1_(operand1), operand2_(operand2)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return ((operand1_.eval(x, y, z) < operand2_.eval(x, y, z)) ?
+                        operand1_.eval(x, y, z) : operand2_.eval(x, y, z));
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return ((operand1_.pack_eval(x, y, z) <
+                         operand2_.pack_eval(x, y, z)) ?
+                        operand1_.pack_eval(x, y, z) :
+                        operand2_.pack_eval(x, y, z));
+             }
+
+            private:
+             Operand1 operand1_;
+
+             Operand2 operand2_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Operand1, typename Operand2>
           struct MinFcn<GPUWalk, Operand1, Operand2> {
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_ParallelRegion_h
+#define Nebo_ParallelRegion_h
+
+#include <vector>
+
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/ThreadPool.h>
+#include <spatialops/CountdownLatch.h>
+#include <spatialops/structured/IntVec.h>
+#include <spatialops/structured/MemoryWindow.h>
+
+#include <boost/function.hpp>
+#include <boost/thread/tss.hpp>
+
+namespace SpatialOps{
+
+  struct Initial;
+  template<typename CurrentMode, typename Pts, typename Arg, typename FieldType> struct NeboStencil;
+  template<typename CurrentMode, typename Pts, typename Arg, typename FieldType> struct NeboSumStencil;
+  template<typename CurrentMode, typename Point, typename Arg, typename FieldType> struct NeboMaskShift;
+
+  /**
+   * @struct NeboReadsNeighbors
+   * @brief \c result is true if evaluating the Nebo expression \c Expr at a
+   *  point reads other points, i.e. if it contains a stencil.
+   *
+   * Expression nodes are recognized by shape: the template arguments of any
+   * class template with up to five type parameters are searched.
+   */
+  template<typename Expr>
+  struct NeboReadsNeighbors{ enum { result = false }; };
+
+  template<typename Pts, typename Arg, typename FieldType>
+  struct NeboReadsNeighbors< NeboStencil<Initial,Pts,Arg,FieldType> >{ enum { result = true }; };
+  template<typename Pts, typename Arg, typename FieldType>
+  struct NeboReadsNeighbors< NeboSumStencil<Initial,Pts,Arg,FieldType> >{ enum { result = true }; };
+  template<typename Point, typename Arg, typename FieldType>
+  struct NeboReadsNeighbors< NeboMaskShift<Initial,Point,Arg,FieldType> >{ enum { result = true }; };
+
+  template<template<typename> class Node, typename A>
+  struct NeboReadsNeighbors< Node<A> >{
+    enum { result = NeboReadsNeighbors<A>::result };
+  };
+  template<template<typename,typename> class Node, typename A, typename B>
+  struct NeboReadsNeighbors< Node<A,B> >{
+    enum { result = NeboReadsNeighbors<A>::result || NeboReadsNeighbors<B>::result };
+  };
+  template<template<typename,typename,typename> class Node, typename A, typename B, typename C>
+  struct NeboReadsNeighbors< Node<A,B,C> >{
+    enum { result = NeboReadsNeighbors<A>::result || NeboReadsNeighbors<B>::result
+                 || NeboReadsNeighbors<C>::result };
+  };
+  template<template<typename,typename,typename,typename> class Node, typename A, typename B, typename C, typename D>
+  struct NeboReadsNeighbors< Node<A,B,C,D> >{
+    enum { result = NeboReadsNeighbors<A>::result || NeboReadsNeighbors<B>::result
+                 || NeboReadsNeighbors<C>::result || NeboReadsNeighbors<D>::result };
+  };
+  template<template<typename,typename,typename,typename,typename> class Node, typename A, typename B, typename C, typename D, typename E>
+  struct NeboReadsNeighbors< Node<A,B,C,D,E> >{
+    enum { result = NeboReadsNeighbors<A>::result || NeboReadsNeighbors<B>::result
+                 || NeboReadsNeighbors<C>::result || NeboReadsNeighbors<D>::result
+                 || NeboReadsNeighbors<E>::result };
+  };
+
+  /**
+   * @class NeboParallelRegion
+   * @brief Runs the thread-parallel Nebo assignments made while it is in
+   *  scope without a fork/join per statement.
+   *
+   * Example:
+   * \code
+   *   {
+   *     NeboParallelRegion region;
+   *     a <<= b + c;
+   *     d <<= a * a;        // runs right behind the previous statement
+   *     e <<= interp( d );  // stencil: waits for all of d first
+   *   } // waits for everything
+   * \endcode
+   *
+   * Inside a region, each partition of a statement is queued on the
+   * ThreadPoolAffine worker that owns that partition index, and the calling
+   * thread moves on to the next statement right away.  Successive statements
+   * over the same partitions therefore run in order on the same workers.
+   * The calling thread only waits (a barrier) before a statement whose
+   * partitions differ from the previous statement's, and before and after a
+   * statement that reads neighboring points (see NeboReadsNeighbors), since
+   * only those can see values that another worker has not yet written.
+   *
+   * Because assignments complete asynchronously:
+   *  - call \c sync before reading field values on the calling thread
+   *    (e.g. reductions, comparisons or output);
+   *  - fields assigned or read inside the region must outlive it, or the
+   *    region must be synced before they go away.  Fields from the
+   *    SpatialFieldStore are handled automatically: those released inside the
+   *    region are returned to the store when it next synchronizes.
+   *
+   * A region applies to assignments made by the thread that created it.
+   * Creating a region inside another one syncs the outer region first.
+   */
+  class NeboParallelRegion{
+  public:
+    typedef boost::function0<void> Task;
+
+    NeboParallelRegion();
+
+    /** @brief waits for all the statements of the region */
+    ~NeboParallelRegion();
+
+    /**
+     * @brief Wait until every statement issued so far has completed, then
+     *  run the deferred work (e.g. returning fields to the store).
+     */
+    void sync();
+
+    /**
+     * @brief Called by Nebo before queuing the partitions of a statement.
+     * @param split the partitioning of the statement
+     * @param window the (resized) window of the left-hand side
+     * @param readsNeighbors whether the right-hand side contains a stencil
+     * @param nparts the number of partitions that will count down the latch
+     * @return the latch the partitions count down when they finish
+     */
+    CountdownLatch* begin_statement( const structured::IntVec& split,
+                                     const structured::MemoryWindow& window,
+                                     const bool readsNeighbors,
+                                     const int nparts );
+
+    /**
+     * @brief run \c task the next time the region synchronizes
+     */
+    void defer( const Task& task ){ deferred_.push_back( task ); }
+
+    /**
+     * @return the region that the calling thread is in, or NULL
+     */
+    static NeboParallelRegion* current(){ return tss().get(); }
+
+  private:
+    NeboParallelRegion* const outer_;
+    CountdownLatch* latch_;
+    bool lastReadsNeighbors_;
+    structured::IntVec lastSplit_;
+    structured::MemoryWindow lastWindow_;
+    std::vector<Task> deferred_;
+
+    static void no_cleanup( NeboParallelRegion* ){}
+    static boost::thread_specific_ptr<NeboParallelRegion>& tss(){
+      static boost::thread_specific_ptr<NeboParallelRegion> region( &NeboParallelRegion::no_cleanup );
+      return region;
+    }
+
+    NeboParallelRegion( const NeboParallelRegion& );
+    NeboParallelRegion& operator=( const NeboParallelRegion& );
+  };
+
+  //------------------------------------------------------------------
+
+  inline NeboParallelRegion::NeboParallelRegion()
+    : outer_( current() ),
+      latch_( NULL ),
+      lastReadsNeighbors_( false ),
+      lastSplit_( 0, 0, 0 ),
+      lastWindow_( structured::IntVec(1,1,1) )
+  {
+    if( outer_ ) outer_->sync();
+    tss().reset( this );
+  }
+
+  inline NeboParallelRegion::~NeboParallelRegion()
+  {
+    sync();
+    tss().reset( outer_ );
+  }
+
+  inline void NeboParallelRegion::sync()
+  {
+    if( latch_ ){
+      latch_->wait();
+      delete latch_;
+      latch_ = NULL;
+    }
+    lastSplit_ = structured::IntVec(0,0,0);
+    // deferred tasks may release fields, which would be deferred again
+    std::vector<Task> deferred;
+    deferred.swap( deferred_ );
+    tss().reset( outer_ );
+    for( std::vector<Task>::const_iterator i=deferred.begin(); i!=deferred.end(); ++i ) (*i)();
+    tss().reset( this );
+  }
+
+  inline CountdownLatch*
+  NeboParallelRegion::begin_statement( const structured::IntVec& split,
+                                       const structured::MemoryWindow& window,
+                                       const bool readsNeighbors,
+                                       const int nparts )
+  {
+    const bool samePartitions = split == lastSplit_ && window == lastWindow_;
+    if( latch_ && ( readsNeighbors || lastReadsNeighbors_ || !samePartitions ) ){
+      latch_->wait();
+      delete latch_;
+      latch_ = NULL;
+    }
+    if( !latch_ ) latch_ = new CountdownLatch( 0 );
+    latch_->add( nparts );
+    lastReadsNeighbors_ = readsNeighbors;
+    lastSplit_  = split;
+    lastWindow_ = window;
+    return latch_;
+  }
+
+} // namespace SpatialOps
+
+#endif // Nebo_ParallelRegion_h
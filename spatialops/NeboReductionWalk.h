@@ -0,0 +1,743 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_Reduction_Walk_h
+#define Nebo_Reduction_Walk_h
+
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/NeboBasic.h>
+#include <spatialops/NeboCond.h>
+#include <spatialops/structured/IntVec.h>
+#include <spatialops/structured/GhostData.h>
+#include <spatialops/structured/MemoryWindow.h>
+
+#include <cmath>
+#include <algorithm>
+
+#include <boost/scoped_array.hpp>
+#ifdef FIELD_EXPRESSION_THREADS
+#  include <boost/bind.hpp>
+#endif
+
+/*
+ * Rows (of x) per block of a reproducible reduction.  The blocks, and so
+ * the grouping of the points, only depend on the extent of the window.
+ */
+#ifndef NEBO_REDUCE_BLOCK_ROWS
+#  define NEBO_REDUCE_BLOCK_ROWS 16
+#endif
+
+namespace SpatialOps{
+
+  /**
+   * @struct NeboReduceSum
+   * @brief Reduction operator for nebo_reduce: the sum of two values.
+   *
+   * A reduction operator is a functor combining two values of the field's
+   * value type.  It must be associative, since nebo_reduce is free to combine
+   * the points in any grouping: lane by lane under NEBO_SIMD and partition by
+   * partition under FIELD_EXPRESSION_THREADS.  Operators that also combine
+   * two NeboSIMDDouble packs lane-wise are marked by NeboReduceVectorized.
+   */
+  template<typename AtomicType>
+  struct NeboReduceSum{
+    inline AtomicType operator()( const AtomicType& a, const AtomicType& b ) const{ return a + b; }
+#   ifdef NEBO_SIMD
+    inline NeboSIMDDouble operator()( const NeboSIMDDouble a, const NeboSIMDDouble b ) const{ return a + b; }
+#   endif
+  };
+
+  /**
+   * @struct NeboReduceMax
+   * @brief Reduction operator for nebo_reduce: the larger of two values (as
+   *  \c std::max, the first one if they compare equal).
+   */
+  template<typename AtomicType>
+  struct NeboReduceMax{
+    inline AtomicType operator()( const AtomicType& a, const AtomicType& b ) const{ return a < b ? b : a; }
+#   ifdef NEBO_SIMD
+    inline NeboSIMDDouble operator()( const NeboSIMDDouble a, const NeboSIMDDouble b ) const{ return a < b ? b : a; }
+#   endif
+  };
+
+  /**
+   * @struct NeboReduceMin
+   * @brief Reduction operator for nebo_reduce: the smaller of two values (as
+   *  \c std::min, the first one if they compare equal).
+   */
+  template<typename AtomicType>
+  struct NeboReduceMin{
+    inline AtomicType operator()( const AtomicType& a, const AtomicType& b ) const{ return b < a ? b : a; }
+#   ifdef NEBO_SIMD
+    inline NeboSIMDDouble operator()( const NeboSIMDDouble a, const NeboSIMDDouble b ) const{ return b < a ? b : a; }
+#   endif
+  };
+
+  /**
+   * @struct NeboReduceNorm
+   * @brief Reduction operator for nebo_reduce: the L2 norm.  The operator
+   *  sums squares; NeboReduceTraits squares each point and takes the root of
+   *  the result.
+   */
+  template<typename AtomicType>
+  struct NeboReduceNorm{
+    inline AtomicType operator()( const AtomicType& a, const AtomicType& b ) const{ return a + b; }
+#   ifdef NEBO_SIMD
+    inline NeboSIMDDouble operator()( const NeboSIMDDouble a, const NeboSIMDDouble b ) const{ return a + b; }
+#   endif
+  };
+
+  /**
+   * @struct NeboReduceTraits
+   * @brief How the reduction operator \c Op treats the values of the points:
+   *  \c lift maps the value of each point before it is combined, and
+   *  \c finish maps the combined result.  Both are the identity by default.
+   */
+  template<typename Op>
+  struct NeboReduceTraits{
+    template<typename T> static inline T lift( const T x ){ return x; }
+    template<typename T> static inline T finish( const T x ){ return x; }
+  };
+
+  template<typename AtomicType>
+  struct NeboReduceTraits< NeboReduceNorm<AtomicType> >{
+    template<typename T> static inline T lift( const T x ){ return x * x; }
+    template<typename T> static inline T finish( const T x ){ return std::sqrt(x); }
+  };
+
+  /**
+   * @struct NeboReduceVectorized
+   * @brief \c result is true if the reduction operator (or reducer) \c Op
+   *  can also combine NeboSIMDDouble packs.
+   */
+  template<typename Op> struct NeboReduceVectorized{ enum { result = false }; };
+  template<typename T> struct NeboReduceVectorized< NeboReduceSum<T>  >{ enum { result = true }; };
+  template<typename T> struct NeboReduceVectorized< NeboReduceMax<T>  >{ enum { result = true }; };
+  template<typename T> struct NeboReduceVectorized< NeboReduceMin<T>  >{ enum { result = true }; };
+  template<typename T> struct NeboReduceVectorized< NeboReduceNorm<T> >{ enum { result = true }; };
+
+  /*
+   * A reducer tells the walks below how to reduce the points of an
+   * expression whose values are of type T into a Result<T>::type, going
+   * through partial results of type Partial<T>::type:
+   *
+   *   lift(x)         the partial result of a single point
+   *   operator()(a,b) combines two partial results
+   *   finish(a)       the result from the combined partial results
+   *   lane(pack,i)    lane i of a partial result of NeboSIMDDouble packs
+   *
+   * NeboReduceOne reduces with one reduction operator, NeboReduceList with
+   * several at once.
+   */
+
+  /**
+   * @struct NeboReduceOne
+   * @brief Reducer for a single reduction operator
+   */
+  template<typename Op>
+  struct NeboReduceOne{
+    template<typename T> struct Result { typedef T type; };
+    template<typename T> struct Partial{ typedef T type; };
+
+    NeboReduceOne( const Op& op ) : op_(op) {}
+
+    template<typename T> inline T lift( const T x ) const{ return NeboReduceTraits<Op>::lift(x); }
+    template<typename T> inline T operator()( const T& a, const T& b ) const{ return op_(a,b); }
+    template<typename T> inline T finish( const T& a ) const{ return NeboReduceTraits<Op>::finish(a); }
+#   ifdef NEBO_SIMD
+    inline double lane( const NeboSIMDDouble pack, const int i ) const{ return pack[i]; }
+#   endif
+
+  private:
+    const Op op_;
+  };
+
+  template<typename Op>
+  struct NeboReduceVectorized< NeboReduceOne<Op> >{ enum { result = NeboReduceVectorized<Op>::result }; };
+
+  /**
+   * @struct NeboCompensatedSum
+   * @brief A sum carried together with its rounding errors (Neumaier's
+   *  variant of Kahan summation)
+   */
+  template<typename T>
+  struct NeboCompensatedSum{
+    T sum;         ///< the rounded sum
+    T correction;  ///< the rounding errors made computing sum, added up
+
+    NeboCompensatedSum() : sum(0), correction(0) {}
+    NeboCompensatedSum( const T x ) : sum(x), correction(0) {}
+
+    inline NeboCompensatedSum& operator+=( const NeboCompensatedSum& other ){
+      const T t = sum + other.sum;
+      correction += ( std::abs(sum) >= std::abs(other.sum) ? (sum - t) + other.sum
+                                                            : (other.sum - t) + sum )
+                  + other.correction;
+      sum = t;
+      return *this;
+    }
+
+    inline T value() const{ return sum + correction; }
+  };
+
+  /**
+   * @struct NeboReduceCompensated
+   * @brief Reducer for NeboReduceSum or NeboReduceNorm that sums with
+   *  NeboCompensatedSum
+   */
+  template<typename Op>
+  struct NeboReduceCompensated{
+    template<typename T> struct Result { typedef T type; };
+    template<typename T> struct Partial{ typedef NeboCompensatedSum<T> type; };
+
+    NeboReduceCompensated( const Op& ) {}
+
+    template<typename T>
+    inline NeboCompensatedSum<T> lift( const T x ) const{
+      return NeboCompensatedSum<T>( NeboReduceTraits<Op>::lift(x) );
+    }
+    template<typename T>
+    inline NeboCompensatedSum<T> operator()( NeboCompensatedSum<T> a, const NeboCompensatedSum<T>& b ) const{
+      return a += b;
+    }
+    template<typename T>
+    inline T finish( const NeboCompensatedSum<T>& a ) const{
+      return NeboReduceTraits<Op>::finish( a.value() );
+    }
+  };
+
+  /**
+   * @struct NeboReduceReproducible
+   * @brief The reducer that nebo_reduce_reproducible uses for the reduction
+   *  operator \c Op: sums are compensated, other operators are used as is.
+   */
+  template<typename Op> struct NeboReduceReproducible{ typedef NeboReduceOne<Op> Reducer; };
+  template<typename T> struct NeboReduceReproducible< NeboReduceSum<T>  >{ typedef NeboReduceCompensated< NeboReduceSum<T>  > Reducer; };
+  template<typename T> struct NeboReduceReproducible< NeboReduceNorm<T> >{ typedef NeboReduceCompensated< NeboReduceNorm<T> > Reducer; };
+
+  /**
+   * @brief The \c i-th value of the results of a NeboReduceList
+   */
+  template<int i>
+  struct NeboReduceValue{
+    template<typename Values>
+    static inline typename Values::value_type const & get( const Values& values ){
+      return NeboReduceValue<i-1>::get( values.rest );
+    }
+  };
+
+  template<>
+  struct NeboReduceValue<0>{
+    template<typename Values>
+    static inline typename Values::value_type const & get( const Values& values ){
+      return values.value;
+    }
+  };
+
+  /**
+   * @struct NeboReduceList
+   * @brief A list of up to four reduction operators, all applied by
+   *  nebo_reduce_many in a single pass over the expression.
+   *
+   * Example:
+   * \code
+   *   typedef NeboReduceList< NeboReduceMax<double>, NeboReduceMin<double>, NeboReduceNorm<double> > Stats;
+   *   const Stats::Values<double> stats = nebo_reduce_many( Stats(), a*b );
+   *   const double max = stats.get<0>(), min = stats.get<1>(), norm = stats.get<2>();
+   * \endcode
+   *
+   * Operators that are not default-constructible (function pointers) are
+   * given to the constructor.
+   */
+  template<typename Op1,
+           typename Op2 = NeboNil,
+           typename Op3 = NeboNil,
+           typename Op4 = NeboNil>
+  struct NeboReduceList{
+    typedef NeboReduceList<Op2,Op3,Op4> Rest;
+#   ifdef NEBO_REPRODUCIBLE_REDUCTIONS
+    typedef typename NeboReduceReproducible<Op1>::Reducer Reducer;
+#   else
+    typedef NeboReduceOne<Op1> Reducer;
+#   endif
+
+    enum { size = 1 + Rest::size };
+
+    /**
+     * @brief The results of the operators of the list, in order
+     */
+    template<typename T>
+    struct Values{
+      typedef T value_type;
+      T value;
+      typename Rest::template Values<T> rest;
+      template<int i> inline T const & get() const{ return NeboReduceValue<i>::get( *this ); }
+    };
+
+    template<typename T>
+    struct Partials{
+      typename Reducer::template Partial<T>::type value;
+      typename Rest::template Partials<T> rest;
+    };
+
+    template<typename T> struct Result { typedef Values<T> type; };
+    template<typename T> struct Partial{ typedef Partials<T> type; };
+
+    NeboReduceList( const Op1& op1 = Op1(),
+                    const Op2& op2 = Op2(),
+                    const Op3& op3 = Op3(),
+                    const Op4& op4 = Op4() )
+    : reducer_(op1), rest_(op2,op3,op4)
+    {}
+
+    template<typename T>
+    inline Partials<T> lift( const T x ) const{
+      Partials<T> result;
+      result.value = reducer_.lift(x);
+      result.rest = rest_.lift(x);
+      return result;
+    }
+
+    template<typename T>
+    inline Partials<T> operator()( const Partials<T>& a, const Partials<T>& b ) const{
+      Partials<T> result;
+      result.value = reducer_( a.value, b.value );
+      result.rest = rest_( a.rest, b.rest );
+      return result;
+    }
+
+    template<typename T>
+    inline Values<T> finish( const Partials<T>& a ) const{
+      Values<T> result;
+      result.value = reducer_.finish( a.value );
+      result.rest = rest_.finish( a.rest );
+      return result;
+    }
+
+#   ifdef NEBO_SIMD
+    inline Partials<double> lane( const Partials<NeboSIMDDouble>& pack, const int i ) const{
+      Partials<double> result;
+      result.value = reducer_.lane( pack.value, i );
+      result.rest = rest_.lane( pack.rest, i );
+      return result;
+    }
+#   endif
+
+  private:
+    const Reducer reducer_;
+    const Rest rest_;
+  };
+
+  template<>
+  struct NeboReduceList<NeboNil,NeboNil,NeboNil,NeboNil>{
+    enum { size = 0 };
+
+    template<typename T> struct Values{ typedef T value_type; };
+    template<typename T> struct Partials{};
+    template<typename T> struct Result { typedef Values<T> type; };
+    template<typename T> struct Partial{ typedef Partials<T> type; };
+
+    NeboReduceList( const NeboNil& = NeboNil(),
+                    const NeboNil& = NeboNil(),
+                    const NeboNil& = NeboNil(),
+                    const NeboNil& = NeboNil() )
+    {}
+
+    template<typename T> inline Partials<T> lift( const T ) const{ return Partials<T>(); }
+    template<typename T> inline Partials<T> operator()( const Partials<T>&, const Partials<T>& ) const{ return Partials<T>(); }
+    template<typename T> inline Values<T> finish( const Partials<T>& ) const{ return Values<T>(); }
+#   ifdef NEBO_SIMD
+    inline Partials<double> lane( const Partials<NeboSIMDDouble>&, const int ) const{ return Partials<double>(); }
+#   endif
+  };
+
+  template<>
+  struct NeboReduceVectorized< NeboReduceList<NeboNil,NeboNil,NeboNil,NeboNil> >{ enum { result = true }; };
+
+  template<typename Op1, typename Op2, typename Op3, typename Op4>
+  struct NeboReduceVectorized< NeboReduceList<Op1,Op2,Op3,Op4> >{
+    enum { result = NeboReduceVectorized<Op1>::result
+                 && NeboReduceVectorized< NeboReduceList<Op2,Op3,Op4> >::result };
+  };
+
+  /**
+   * @brief Combine the values of a SeqWalk expression over \c extent points,
+   *  starting from the first point and going in memory order (x fastest).
+   */
+  template<typename PartialType, typename Reducer, typename WalkType>
+  inline PartialType nebo_reduce_walk( const Reducer& reducer,
+                                      const WalkType& expr,
+                                      const structured::IntVec& extent )
+  {
+    PartialType result = reducer.lift( expr.eval(0,0,0) );
+    int x = 1;
+    for( int z=0; z<extent[2]; ++z ){
+      for( int y=0; y<extent[1]; ++y ){
+        for( ; x<extent[0]; ++x ) result = reducer( result, reducer.lift( expr.eval(x,y,z) ) );
+        x = 0;
+      }
+    }
+    return result;
+  }
+
+# ifdef NEBO_SIMD
+  /**
+   * @brief Combine the values of a SIMDWalk expression over \c extent points.
+   *
+   * Each lane accumulates every NEBO_SIMD_WIDTH-th point of a row, the
+   * points past the last full pack of each row are accumulated separately,
+   * and the lanes are combined at the end.  Requires at least
+   * NEBO_SIMD_WIDTH points in x.
+   */
+  template<typename PartialType, typename Reducer, typename SIMDWalkType>
+  inline PartialType nebo_reduce_simd_walk( const Reducer& reducer,
+                                           const SIMDWalkType& expr,
+                                           const structured::IntVec& extent )
+  {
+    typedef typename Reducer::template Partial<NeboSIMDDouble>::type PackType;
+    const int xPacked = extent[0] - extent[0] % NEBO_SIMD_WIDTH;
+    PackType lanes = reducer.lift( expr.pack_eval(0,0,0) );
+    PartialType tail = PartialType();
+    bool hasTail = false;
+    int x = NEBO_SIMD_WIDTH;
+    for( int z=0; z<extent[2]; ++z ){
+      for( int y=0; y<extent[1]; ++y ){
+        for( ; x<xPacked; x+=NEBO_SIMD_WIDTH ) lanes = reducer( lanes, reducer.lift( expr.pack_eval(x,y,z) ) );
+        for( ; x<extent[0]; ++x ){
+          const PartialType value = reducer.lift( expr.eval(x,y,z) );
+          tail = hasTail ? reducer( tail, value ) : value;
+          hasTail = true;
+        }
+        x = 0;
+      }
+    }
+    PartialType result = reducer.lane( lanes, 0 );
+    for( int i=1; i<NEBO_SIMD_WIDTH; ++i ) result = reducer( result, reducer.lane( lanes, i ) );
+    return hasTail ? reducer( result, tail ) : result;
+  }
+# endif // NEBO_SIMD
+
+  /**
+   * @struct NeboReduceSequential
+   * @brief Reduces an expression on the calling thread, in packs when both
+   *  the value type and the reducer allow it.
+   */
+  template<bool vectorized>
+  struct NeboReduceSequential{
+    template<typename PartialType, typename Reducer, typename ExprType>
+    static inline PartialType reduce( const Reducer& reducer,
+                                     const ExprType& expr,
+                                     const structured::GhostData& ghosts,
+                                     const structured::IntVec& extent )
+    {
+      return nebo_reduce_walk<PartialType>( reducer,
+                                           expr.init( ghosts.get_minus(), ghosts.get_plus(), structured::IntVec(0,0,0) ),
+                                           extent );
+    }
+  };
+
+# ifdef NEBO_SIMD
+  template<>
+  struct NeboReduceSequential<true>{
+    template<typename PartialType, typename Reducer, typename ExprType>
+    static inline PartialType reduce( const Reducer& reducer,
+                                     const ExprType& expr,
+                                     const structured::GhostData& ghosts,
+                                     const structured::IntVec& extent )
+    {
+      if( extent[0] < NEBO_SIMD_WIDTH )
+        return NeboReduceSequential<false>::template reduce<PartialType>( reducer, expr, ghosts, extent );
+      return nebo_reduce_simd_walk<PartialType>( reducer,
+                                                expr.simd_init( ghosts.get_minus(), ghosts.get_plus(), structured::IntVec(0,0,0) ),
+                                                extent );
+    }
+  };
+# endif // NEBO_SIMD
+
+  /**
+   * @brief Combine \c count partial results pairwise, neighbours first, into
+   *  \c partials[0].  The grouping only depends on \c count.
+   */
+  template<typename PartialType, typename Reducer>
+  inline PartialType nebo_reduce_tree( const Reducer& reducer, PartialType* const partials, const int count )
+  {
+    for( int stride=1; stride<count; stride*=2 ){
+      for( int i=0; i+stride<count; i+=2*stride ){
+        partials[i] = reducer( partials[i], partials[i+stride] );
+      }
+    }
+    return partials[0];
+  }
+
+# ifdef FIELD_EXPRESSION_THREADS
+  /**
+   * @brief Task reducing one partition of a resized expression into \c result
+   */
+  template<typename PartialType, typename Reducer, typename ResizeType>
+  inline void nebo_reduce_partition( const Reducer reducer,
+                                     const ResizeType expr,
+                                     const structured::IntVec split,
+                                     const structured::IntVec location,
+                                     const structured::IntVec extent,
+                                     PartialType* const result,
+                                     CountdownLatch* const done )
+  {
+    *result = nebo_reduce_walk<PartialType>( reducer,
+                                            expr.init( structured::IntVec(0,0,0), split, location ),
+                                            structured::MemoryWindow(extent).refine(split,location).extent() );
+    done->count_down();
+  }
+
+  /**
+   * @brief Reduces an expression with the thread pool: one partition per
+   *  active thread, split as thread_parallel_assign splits a field, and the
+   *  partial results combined by nebo_reduce_tree.
+   *
+   * The statements of a NeboParallelRegion write the fields that a reduction
+   * reads, so the current region (if any) is synchronized first.
+   */
+  template<typename PartialType, typename Reducer, typename ExprType>
+  inline PartialType nebo_reduce_thread_parallel( const Reducer& reducer,
+                                                 const ExprType& expr,
+                                                 const structured::GhostData& ghosts,
+                                                 const structured::IntVec& extent )
+  {
+    typedef typename ExprType::ResizeType ResizeType;
+
+    NeboParallelRegion* const region = NeboParallelRegion::current();
+    if( region ) region->sync();
+
+    const structured::IntVec split = nebo_find_partition( extent, get_soft_thread_count() );
+    const int max = nebo_partition_count( split );
+
+    boost::scoped_array<PartialType> partials( new PartialType[max] );
+    CountdownLatch latch( max );
+    const ResizeType resized = expr.resize( ghosts.get_minus(), ghosts.get_plus() );
+
+    structured::IntVec location(0,0,0);
+    for( int count=0; count<max; ++count ){
+      ThreadPoolAffine::Task const task = boost::bind( &nebo_reduce_partition<PartialType,Reducer,ResizeType>,
+                                                       reducer, resized, split, location, extent,
+                                                       &partials[count], &latch );
+#     ifdef NEBO_NUMA
+      ThreadPoolAffine::self().schedule( count, task );
+#     else
+      ThreadPoolFIFO::self().schedule( task );
+#     endif
+      location = nebo_next_partition( location, split );
+    }
+    latch.wait();
+
+    return nebo_reduce_tree( reducer, partials.get(), max );
+  }
+# endif // FIELD_EXPRESSION_THREADS
+
+  /**
+   * @brief Combine the values of a SeqWalk expression on the rows (of x)
+   *  \c firstRow to \c endRow (exclusive), counting rows in memory order.
+   */
+  template<typename PartialType, typename Reducer, typename WalkType>
+  inline PartialType nebo_reduce_rows( const Reducer& reducer,
+                                       const WalkType& expr,
+                                       const structured::IntVec& extent,
+                                       const int firstRow,
+                                       const int endRow )
+  {
+    PartialType result = reducer.lift( expr.eval( 0, firstRow % extent[1], firstRow / extent[1] ) );
+    int x = 1;
+    for( int row=firstRow; row<endRow; ++row ){
+      const int y = row % extent[1];
+      const int z = row / extent[1];
+      for( ; x<extent[0]; ++x ) result = reducer( result, reducer.lift( expr.eval(x,y,z) ) );
+      x = 0;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Reduce the blocks \c firstBlock to \c endBlock (exclusive) of a
+   *  SeqWalk expression, each into its own entry of \c partials
+   */
+  template<typename PartialType, typename Reducer, typename WalkType>
+  inline void nebo_reduce_blocks( const Reducer& reducer,
+                                  const WalkType& expr,
+                                  const structured::IntVec& extent,
+                                  const int firstBlock,
+                                  const int endBlock,
+                                  PartialType* const partials )
+  {
+    const int rows = extent[1] * extent[2];
+    for( int block=firstBlock; block<endBlock; ++block ){
+      const int firstRow = block * NEBO_REDUCE_BLOCK_ROWS;
+      partials[block] = nebo_reduce_rows<PartialType>( reducer, expr, extent,
+                                                       firstRow,
+                                                       std::min( firstRow + NEBO_REDUCE_BLOCK_ROWS, rows ) );
+    }
+  }
+
+# ifdef FIELD_EXPRESSION_THREADS
+  /**
+   * @brief Task reducing a range of blocks of an (Initial mode) expression,
+   *  with its own SeqWalk (walks of a nebo_let cannot be shared by threads)
+   */
+  template<typename PartialType, typename Reducer, typename ExprType>
+  inline void nebo_reduce_blocks_task( const Reducer reducer,
+                                       const ExprType expr,
+                                       const structured::GhostData ghosts,
+                                       const structured::IntVec extent,
+                                       const int firstBlock,
+                                       const int endBlock,
+                                       PartialType* const partials,
+                                       CountdownLatch* const done )
+  {
+    nebo_reduce_blocks<PartialType>( reducer,
+                                     expr.init( ghosts.get_minus(), ghosts.get_plus(), structured::IntVec(0,0,0) ),
+                                     extent, firstBlock, endBlock, partials );
+    done->count_down();
+  }
+# endif // FIELD_EXPRESSION_THREADS
+
+  /**
+   * @brief Reduce the (Initial mode) Nebo expression \c expr with \c
+   *  reducer, giving the same result for any number of threads.
+   *
+   * The window is cut into blocks of NEBO_REDUCE_BLOCK_ROWS rows, each block
+   * is reduced in memory order, and the results of the blocks are combined
+   * pairwise by nebo_reduce_tree.  None of this depends on the number of
+   * threads, which only decides which thread reduces which blocks.  The
+   * points are evaluated one at a time, also under NEBO_SIMD.
+   */
+  template<typename ValueType, typename Reducer, typename ExprType>
+  inline typename Reducer::template Result<ValueType>::type
+  nebo_reduce_in_blocks( const Reducer& reducer,
+                         const ExprType& expr,
+                         const structured::GhostData& ghosts )
+  {
+    typedef typename Reducer::template Partial<ValueType>::type PartialType;
+
+    const structured::IntVec extent = expr.extent( ghosts.get_minus(), ghosts.get_plus() );
+    const int rows = extent[1] * extent[2];
+    const int blocks = ( rows + NEBO_REDUCE_BLOCK_ROWS - 1 ) / NEBO_REDUCE_BLOCK_ROWS;
+
+    boost::scoped_array<PartialType> partials( new PartialType[blocks] );
+    // built here even when the threads build their own, so that errors are thrown in this thread
+    const typename ExprType::SeqWalkType walk = expr.init( ghosts.get_minus(), ghosts.get_plus(), structured::IntVec(0,0,0) );
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    if( is_thread_parallel() ){
+      NeboParallelRegion* const region = NeboParallelRegion::current();
+      if( region ) region->sync();
+
+      const int workers = std::min( get_soft_thread_count(), blocks );
+      CountdownLatch latch( workers );
+      for( int worker=0; worker<workers; ++worker ){
+        ThreadPoolAffine::Task const task = boost::bind( &nebo_reduce_blocks_task<PartialType,Reducer,ExprType>,
+                                                         reducer, expr, ghosts, extent,
+                                                         worker * blocks / workers,
+                                                         (worker+1) * blocks / workers,
+                                                         partials.get(), &latch );
+#       ifdef NEBO_NUMA
+        ThreadPoolAffine::self().schedule( worker, task );
+#       else
+        ThreadPoolFIFO::self().schedule( task );
+#       endif
+      }
+      latch.wait();
+    }
+    else
+#   endif // FIELD_EXPRESSION_THREADS
+      nebo_reduce_blocks<PartialType>( reducer, walk, extent, 0, blocks, partials.get() );
+
+    return reducer.finish( nebo_reduce_tree( reducer, partials.get(), blocks ) );
+  }
+
+  /**
+   * @brief Reduce the (Initial mode) Nebo expression \c expr, with the
+   *  ghost cells \c ghosts, using the reduction operator \c op, so that the
+   *  result does not depend on the number of threads (nebo_reduce_in_blocks).
+   *  Sums and norms are also compensated (NeboCompensatedSum).
+   */
+  template<typename ValueType, typename Op, typename ExprType>
+  inline ValueType nebo_reduce_expression_reproducible( const Op& op,
+                                                        const ExprType& expr,
+                                                        const structured::GhostData& ghosts )
+  {
+    return nebo_reduce_in_blocks<ValueType>( typename NeboReduceReproducible<Op>::Reducer(op), expr, ghosts );
+  }
+
+  /**
+   * @brief Reduce the (Initial mode) Nebo expression \c expr, whose values
+   *  are of type \c ValueType, with the ghost cells \c ghosts, using
+   *  \c reducer.  The expression is evaluated once per point.
+   *
+   * Uses the thread pool under FIELD_EXPRESSION_THREADS (when it has
+   * threads), and packs under NEBO_SIMD.  Otherwise the points are combined
+   * in memory order, as the Reduction mode walks them.  Under
+   * NEBO_REPRODUCIBLE_REDUCTIONS the points are always grouped by
+   * nebo_reduce_in_blocks instead.
+   */
+  template<typename ValueType, typename Reducer, typename ExprType>
+  inline typename Reducer::template Result<ValueType>::type
+  nebo_reduce_with( const Reducer& reducer,
+                    const ExprType& expr,
+                    const structured::GhostData& ghosts )
+  {
+#   ifdef NEBO_REPRODUCIBLE_REDUCTIONS
+    return nebo_reduce_in_blocks<ValueType>( reducer, expr, ghosts );
+#   else
+    typedef typename Reducer::template Partial<ValueType>::type PartialType;
+    const structured::IntVec extent = expr.extent( ghosts.get_minus(), ghosts.get_plus() );
+#   ifdef FIELD_EXPRESSION_THREADS
+    if( is_thread_parallel() )
+      return reducer.finish( nebo_reduce_thread_parallel<PartialType>( reducer, expr, ghosts, extent ) );
+#   endif
+#   ifdef NEBO_SIMD
+    return reducer.finish( NeboReduceSequential< NeboSIMDPack<ValueType>::vectorized && NeboReduceVectorized<Reducer>::result >
+                             ::template reduce<PartialType>( reducer, expr, ghosts, extent ) );
+#   else
+    return reducer.finish( NeboReduceSequential<false>::template reduce<PartialType>( reducer, expr, ghosts, extent ) );
+#   endif
+#   endif // NEBO_REPRODUCIBLE_REDUCTIONS
+  }
+
+  /**
+   * @brief Reduce the (Initial mode) Nebo expression \c expr, with the
+   *  ghost cells \c ghosts, using the reduction operator \c op.
+   *
+   * Under NEBO_REPRODUCIBLE_REDUCTIONS this is
+   * nebo_reduce_expression_reproducible.
+   */
+  template<typename ValueType, typename Op, typename ExprType>
+  inline ValueType nebo_reduce_expression( const Op& op,
+                                           const ExprType& expr,
+                                           const structured::GhostData& ghosts )
+  {
+#   ifdef NEBO_REPRODUCIBLE_REDUCTIONS
+    return nebo_reduce_expression_reproducible<ValueType>( op, expr, ghosts );
+#   else
+    return nebo_reduce_with<ValueType>( NeboReduceOne<Op>(op), expr, ghosts );
+#   endif
+  }
+
+} // namespace SpatialOps
+
+#endif // Nebo_Reduction_Walk_h
@@ -152,23 +152,9 @@
                                                          const & fexpr) {
           structured::GhostData ghosts = fexpr.expr().possible_ghosts();
 
-          const structured::IntVec shift = structured::IntVec(0, 0, 0);
-
-          typename ExprType::ReductionType expr = fexpr.expr().reduce_init(ghosts.get_minus(),
-                                                                           ghosts.get_plus(),
-                                                                           shift);
-
-          typename FieldType::value_type result = expr.eval();
-
-          expr.next();
-
-          while(!(expr.at_end())) {
-             result = proc(result, expr.eval());
-
-             expr.next();
-          };
-
-          return result;
+          return nebo_reduce_expression<typename FieldType::value_type>(proc,
+                                                                        fexpr.expr(),
+                                                                        ghosts);
        };
 
       template<typename FieldType>
@@ -209,23 +195,9 @@
                                                                   const & fexpr) {
           structured::GhostData ghosts(0);
 
-          const structured::IntVec shift = structured::IntVec(0, 0, 0);
-
-          typename ExprType::ReductionType expr = fexpr.expr().reduce_init(ghosts.get_minus(),
-                                                                           ghosts.get_plus(),
-                                                                           shift);
-
-          typename FieldType::value_type result = expr.eval();
-
-          expr.next();
-
-          while(!(expr.at_end())) {
-             result = proc(result, expr.eval());
-
-             expr.next();
-          };
-
-          return result;
+          return nebo_reduce_expression<typename FieldType::value_type>(proc,
+                                                                        fexpr.expr(),
+                                                                        ghosts);
        };
 
       template<typename FieldType>
@@ -266,23 +238,9 @@
                                                          const & fexpr) {
           structured::GhostData ghosts = fexpr.expr().possible_ghosts();
 
-          const structured::IntVec shift = structured::IntVec(0, 0, 0);
-
-          typename ExprType::ReductionType expr = fexpr.expr().reduce_init(ghosts.get_minus(),
-                                                                           ghosts.get_plus(),
-                                                                           shift);
-
-          typename FieldType::value_type result = expr.eval();
-
-          expr.next();
-
-          while(!(expr.at_end())) {
-             result = proc(result, expr.eval());
-
-             expr.next();
-          };
-
-          return result;
+          return nebo_reduce_expression<typename FieldType::value_type>(proc,
+                                                                        fexpr.expr(),
+                                                                        ghosts);
        };
 
       template<typename FieldType>
@@ -322,23 +280,9 @@
                                                                   const & fexpr) {
           structured::GhostData ghosts(0);
 
-          const structured::IntVec shift = structured::IntVec(0, 0, 0);
-
-          typename ExprType::ReductionType expr = fexpr.expr().reduce_init(ghosts.get_minus(),
-                                                                           ghosts.get_plus(),
-                                                                           shift);
-
-          typename FieldType::value_type result = expr.eval();
-
-          expr.next();
-
-          while(!(expr.at_end())) {
-             result = proc(result, expr.eval());
-
-             expr.next();
-          };
-
-          return result;
+          return nebo_reduce_expression<typename FieldType::value_type>(proc,
+                                                                        fexpr.expr(),
+                                                                        ghosts);
        };
 
       template<typename FieldType>
@@ -362,11 +306,96 @@
           return nebo_reduce_interior(proc, NeboExpression<ExprType, FieldType>(ExprType(field)));
        };
 
+      template<typename ReduceOp, typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce(ReduceOp const & op,
+                                                         NeboExpression<ExprType,
+                                                                        FieldType>
+                                                         const & fexpr) {
+          structured::GhostData ghosts = fexpr.expr().possible_ghosts();
+
+          return nebo_reduce_expression<typename FieldType::value_type>(op,
+                                                                        fexpr.expr(),
+                                                                        ghosts);
+       };
+
+      template<typename ReduceOp, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce(ReduceOp const & op,
+                                                         FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_reduce(op, NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ReduceOp, typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce_interior(ReduceOp const &
+                                                                  op,
+                                                                  NeboExpression<ExprType,
+                                                                                 FieldType>
+                                                                  const & fexpr) {
+          structured::GhostData ghosts(0);
+
+          return nebo_reduce_expression<typename FieldType::value_type>(op,
+                                                                        fexpr.expr(),
+                                                                        ghosts);
+       };
+
+      template<typename ReduceOp, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce_interior(ReduceOp const &
+                                                                  op,
+                                                                  FieldType
+                                                                  const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_reduce_interior(op, NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ReduceOps, typename ExprType, typename FieldType>
+       inline typename ReduceOps::template Values<typename FieldType::value_type>
+       nebo_reduce_many(ReduceOps const & ops,
+                        NeboExpression<ExprType, FieldType> const & fexpr) {
+          structured::GhostData ghosts = fexpr.expr().possible_ghosts();
+
+          return nebo_reduce_with<typename FieldType::value_type>(ops,
+                                                                  fexpr.expr(),
+                                                                  ghosts);
+       };
+
+      template<typename ReduceOps, typename FieldType>
+       inline typename ReduceOps::template Values<typename FieldType::value_type>
+       nebo_reduce_many(ReduceOps const & ops, FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_reduce_many(ops, NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ReduceOps, typename ExprType, typename FieldType>
+       inline typename ReduceOps::template Values<typename FieldType::value_type>
+       nebo_reduce_many_interior(ReduceOps const & ops,
+                                 NeboExpression<ExprType, FieldType> const &
+                                 fexpr) {
+          structured::GhostData ghosts(0);
+
+          return nebo_reduce_with<typename FieldType::value_type>(ops,
+                                                                  fexpr.expr(),
+                                                                  ghosts);
+       };
+
+      template<typename ReduceOps, typename FieldType>
+       inline typename ReduceOps::template Values<typename FieldType::value_type>
+       nebo_reduce_many_interior(ReduceOps const & ops,
+                                 FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_reduce_many_interior(ops,
+                                           NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
       template<typename ExprType, typename FieldType>
        inline typename FieldType::value_type nebo_max(NeboExpression<ExprType,
                                                                      FieldType>
                                                       const & fexpr) {
-          return nebo_reduce(std::max, fexpr);
+          return nebo_reduce(NeboReduceMax<typename FieldType::value_type>(),
+                             fexpr);
        };
 
       template<typename FieldType>
@@ -380,7 +409,8 @@
        inline typename FieldType::value_type nebo_max_interior(NeboExpression<ExprType,
                                                                               FieldType>
                                                                const & fexpr) {
-          return nebo_reduce_interior(std::max, fexpr);
+          return nebo_reduce_interior(NeboReduceMax<typename FieldType::value_type>(),
+                                      fexpr);
        };
 
       template<typename FieldType>
@@ -395,7 +425,8 @@
        inline typename FieldType::value_type nebo_min(NeboExpression<ExprType,
                                                                      FieldType>
                                                       const & fexpr) {
-          return nebo_reduce(std::min, fexpr);
+          return nebo_reduce(NeboReduceMin<typename FieldType::value_type>(),
+                             fexpr);
        };
 
       template<typename FieldType>
@@ -409,7 +440,8 @@
        inline typename FieldType::value_type nebo_min_interior(NeboExpression<ExprType,
                                                                               FieldType>
                                                                const & fexpr) {
-          return nebo_reduce_interior(std::min, fexpr);
+          return nebo_reduce_interior(NeboReduceMin<typename FieldType::value_type>(),
+                                      fexpr);
        };
 
       template<typename FieldType>
@@ -429,7 +461,8 @@
        inline typename FieldType::value_type nebo_sum(NeboExpression<ExprType,
                                                                      FieldType>
                                                       const & fexpr) {
-          return nebo_reduce(sum<typename FieldType::value_type>, fexpr);
+          return nebo_reduce(NeboReduceSum<typename FieldType::value_type>(),
+                             fexpr);
        };
 
       template<typename FieldType>
@@ -443,7 +476,8 @@
        inline typename FieldType::value_type nebo_sum_interior(NeboExpression<ExprType,
                                                                               FieldType>
                                                                const & fexpr) {
-          return nebo_reduce_interior(sum<typename FieldType::value_type>, fexpr);
+          return nebo_reduce_interior(NeboReduceSum<typename FieldType::value_type>(),
+                                      fexpr);
        };
 
       template<typename FieldType>
@@ -458,7 +492,8 @@
        inline typename FieldType::value_type nebo_norm(NeboExpression<ExprType,
                                                                       FieldType>
                                                        const & fexpr) {
-          return std::sqrt(nebo_sum(pow(fexpr, 2)));
+          return nebo_reduce(NeboReduceNorm<typename FieldType::value_type>(),
+                             fexpr);
        };
 
       template<typename FieldType>
@@ -472,7 +507,8 @@
        inline typename FieldType::value_type nebo_norm_interior(NeboExpression<ExprType,
                                                                                FieldType>
                                                                 const & fexpr) {
-          return std::sqrt(nebo_sum_interior(pow(fexpr, 2)));
+          return nebo_reduce_interior(NeboReduceNorm<typename FieldType::value_type>(),
+                                      fexpr);
        };
 
       template<typename FieldType>
@@ -482,6 +518,129 @@
 
           return nebo_norm_interior(NeboExpression<ExprType, FieldType>(ExprType(field)));
        };
+
+      template<typename ReduceOp, typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce_reproducible(ReduceOp
+                                                                      const &
+                                                                      op,
+                                                                      NeboExpression<ExprType,
+                                                                                     FieldType>
+                                                                      const &
+                                                                      fexpr) {
+          structured::GhostData ghosts = fexpr.expr().possible_ghosts();
+
+          return nebo_reduce_expression_reproducible<typename FieldType::
+                                                     value_type>(op,
+                                                                 fexpr.expr(),
+                                                                 ghosts);
+       };
+
+      template<typename ReduceOp, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce_reproducible(ReduceOp
+                                                                      const &
+                                                                      op,
+                                                                      FieldType
+                                                                      const &
+                                                                      field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_reduce_reproducible(op,
+                                          NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ReduceOp, typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce_reproducible_interior(ReduceOp
+                                                                               const
+                                                                               &
+                                                                               op,
+                                                                               NeboExpression<ExprType,
+                                                                                              FieldType>
+                                                                               const
+                                                                               &
+                                                                               fexpr) {
+          structured::GhostData ghosts(0);
+
+          return nebo_reduce_expression_reproducible<typename FieldType::
+                                                     value_type>(op,
+                                                                 fexpr.expr(),
+                                                                 ghosts);
+       };
+
+      template<typename ReduceOp, typename FieldType>
+       inline typename FieldType::value_type nebo_reduce_reproducible_interior(ReduceOp
+                                                                               const
+                                                                               &
+                                                                               op,
+                                                                               FieldType
+                                                                               const
+                                                                               &
+                                                                               field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_reduce_reproducible_interior(op,
+                                                   NeboExpression<ExprType,
+                                                                  FieldType>(ExprType(field)));
+       };
+
+      template<typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_sum_reproducible(NeboExpression<ExprType,
+                                                                FieldType>
+                                                 const & fexpr) {
+          return nebo_reduce_reproducible(NeboReduceSum<typename FieldType::value_type>(),
+                                          fexpr);
+       };
+
+      template<typename FieldType>
+       inline typename FieldType::value_type nebo_sum_reproducible(FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_sum_reproducible(NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_sum_reproducible_interior(NeboExpression<ExprType,
+                                                                FieldType>
+                                                 const & fexpr) {
+          return nebo_reduce_reproducible_interior(NeboReduceSum<typename FieldType::value_type>(),
+                                          fexpr);
+       };
+
+      template<typename FieldType>
+       inline typename FieldType::value_type nebo_sum_reproducible_interior(FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_sum_reproducible_interior(NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_norm_reproducible(NeboExpression<ExprType,
+                                                                FieldType>
+                                                 const & fexpr) {
+          return nebo_reduce_reproducible(NeboReduceNorm<typename FieldType::value_type>(),
+                                          fexpr);
+       };
+
+      template<typename FieldType>
+       inline typename FieldType::value_type nebo_norm_reproducible(FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_norm_reproducible(NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
+
+      template<typename ExprType, typename FieldType>
+       inline typename FieldType::value_type nebo_norm_reproducible_interior(NeboExpression<ExprType,
+                                                                FieldType>
+                                                 const & fexpr) {
+          return nebo_reduce_reproducible_interior(NeboReduceNorm<typename FieldType::value_type>(),
+                                          fexpr);
+       };
+
+      template<typename FieldType>
+       inline typename FieldType::value_type nebo_norm_reproducible_interior(FieldType const & field) {
+          NeboConstField<Initial, FieldType> typedef ExprType;
+
+          return nebo_norm_reproducible_interior(NeboExpression<ExprType, FieldType>(ExprType(field)));
+       };
    } /* SpatialOps */
 
 #endif
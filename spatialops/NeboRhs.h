@@ -45,6 +45,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboScalar<SIMDWalk, AtomicType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboScalar<Reduction, AtomicType> typedef ReductionType;
 
           NeboScalar(value_type const v)
@@ -55,12 +60,26 @@
              return structured::GhostData(GHOST_MAX);
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return structured::IntVec(0, 0, 0);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(value_);
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(value_);
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -129,13 +148,42 @@
           : value_(value)
           {}
 
-          inline void next(void) {}
-
-          inline value_type eval(void) const { return value_; }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return value_;
+          }
 
          private:
           value_type const value_;
       };
+      #ifdef NEBO_SIMD
+         template<typename AtomicType>
+          struct NeboScalar<SIMDWalk, AtomicType> {
+            public:
+             AtomicType typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboScalar(value_type const value)
+             : value_(value)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return value_;
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return NeboSIMDPack<value_type>::broadcast(value_);
+             }
+
+            private:
+             value_type const value_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename AtomicType>
           struct NeboScalar<GPUWalk, AtomicType> {
@@ -197,6 +245,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboConstField<SIMDWalk, FieldType> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboConstField<Reduction, FieldType> typedef ReductionType;
 
           NeboConstField(FieldType const & f)
@@ -207,6 +260,12 @@
              return field_.get_valid_ghost_data() + point_to_ghost(field_.boundary_info().has_extra());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return resize_ghost(field_, minus, plus - field_.boundary_info().has_extra())
+                    .window_with_ghost().extent();
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -216,6 +275,18 @@
                                                               shift));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(resize_ghost_and_shift_window(field_,
+                                                                  minus,
+                                                                  plus - field_.boundary_info().has_extra(),
+                                                                  shift));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -300,16 +371,66 @@
           typename field_type::value_type typedef value_type;
 
           NeboConstField(FieldType const & f)
-          : iter_(f.begin())
+          : base_(f.field_values(LOCAL_RAM) + f.window_with_ghost().offset(0)
+                  + f.window_with_ghost().glob_dim(0) * (f.window_with_ghost().offset(1)
+                                                         + (f.window_with_ghost().glob_dim(1)
+                                                            * f.window_with_ghost().offset(2)))),
+            xGlob_(f.window_with_ghost().glob_dim(0)),
+            yGlob_(f.window_with_ghost().glob_dim(1))
           {}
 
-          inline void next(void) { iter_++; }
-
-          inline value_type eval(void) const { return *iter_; }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return base_[x + xGlob_ * (y + (yGlob_ * z))];
+          }
 
          private:
-          typename FieldType::const_iterator iter_;
+          value_type const * base_;
+
+          int const xGlob_;
+
+          int const yGlob_;
       };
+      #ifdef NEBO_SIMD
+         template<typename FieldType>
+          struct NeboConstField<SIMDWalk, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboConstField(FieldType const & f)
+             : base_(f.field_values(LOCAL_RAM) + f.window_with_ghost().offset(0)
+                     + f.window_with_ghost().glob_dim(0) * (f.window_with_ghost().offset(1)
+                                                            + (f.window_with_ghost().glob_dim(1)
+                                                               * f.window_with_ghost().offset(2)))),
+               xGlob_(f.window_with_ghost().glob_dim(0)),
+               yGlob_(f.window_with_ghost().glob_dim(1))
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return base_[x + xGlob_ * (y + (yGlob_ * z))];
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return NeboSIMDPack<value_type>::load(base_ + x + xGlob_
+                                                      * (y + (yGlob_ * z)));
+             }
+
+            private:
+             value_type const * base_;
+
+             int const xGlob_;
+
+             int const yGlob_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename FieldType>
           struct NeboConstField<GPUWalk, FieldType> {
@@ -394,6 +515,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboConstSingleValueField<SIMDWalk, T> typedef SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboConstSingleValueField<Reduction, T> typedef ReductionType;
 
           NeboConstSingleValueField(SingleValueFieldType const & f)
@@ -404,12 +530,26 @@
              return structured::GhostData(GHOST_MAX);
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return structured::IntVec(0, 0, 0);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(* field_.field_values(LOCAL_RAM));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(* field_.field_values(LOCAL_RAM));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -491,13 +631,46 @@
           : value_(v)
           {}
 
-          inline void next(void) {}
-
-          inline value_type eval(void) const { return value_; }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return value_;
+          }
 
          private:
           double value_;
       };
+      #ifdef NEBO_SIMD
+         template<typename T>
+          struct NeboConstSingleValueField<SIMDWalk, T> {
+            public:
+             SpatialOps::structured::SpatialField<SpatialOps::structured::
+                                                  SingleValue,
+                                                  T> typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboConstSingleValueField(double const & v)
+             : value_(v)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return value_;
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return NeboSIMDPack<value_type>::broadcast(value_);
+             }
+
+            private:
+             double value_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename T>
           struct NeboConstSingleValueField<GPUWalk, T> {
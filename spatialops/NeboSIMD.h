@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_SIMD_h
+#define Nebo_SIMD_h
+
+#include <cmath>
+#include <math.h>
+#include <cstring>
+
+/*
+ * Register width used by the SIMDWalk mode.  The widest instruction set the
+ * compiler was told to target wins: 64 bytes for AVX-512, 32 bytes for AVX
+ * and AVX2, and 16 bytes (SSE2) otherwise.
+ */
+#ifndef NEBO_SIMD_BYTES
+#  if defined(__AVX512F__)
+#    define NEBO_SIMD_BYTES 64
+#  elif defined(__AVX__)
+#    define NEBO_SIMD_BYTES 32
+#  else
+#    define NEBO_SIMD_BYTES 16
+#  endif
+#endif
+
+/* number of double precision lanes in one pack */
+#define NEBO_SIMD_WIDTH ((int)(NEBO_SIMD_BYTES / sizeof(double)))
+
+namespace SpatialOps{
+
+  /**
+   * @brief A pack of NEBO_SIMD_WIDTH double precision lanes.
+   *
+   * Uses the GCC/Clang vector extension, so arithmetic and comparisons on
+   * packs compile directly to packed SSE/AVX/AVX-512 instructions.
+   */
+  typedef double NeboSIMDDouble __attribute__((vector_size(NEBO_SIMD_BYTES)));
+
+  /**
+   * @brief Result of comparing two NeboSIMDDouble packs: each lane is all
+   * ones (true) or all zeros (false).  Usable as the condition of a
+   * lane-wise select (<tt>mask ? a : b</tt>).
+   */
+  typedef __typeof__(NeboSIMDDouble() < NeboSIMDDouble()) NeboSIMDMask;
+
+  /**
+   * @struct NeboSIMDPack
+   * @brief Maps the value type of a Nebo expression node onto the pack type
+   * its SIMDWalk mode produces, and provides the loads, stores and
+   * broadcasts for that type.
+   *
+   * Only double precision fields are evaluated in packs.  Other value types
+   * still get a (converting) pack type so that every node compiles, but
+   * \c vectorized is false and NeboField<SIMDWalk> then evaluates every
+   * point through the scalar \c eval.
+   */
+  template<typename T>
+  struct NeboSIMDPack {
+    typedef NeboSIMDDouble type;
+    enum { vectorized = false };
+
+    static inline type broadcast( const T value ){
+      type result;
+      for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) result[i] = value;
+      return result;
+    }
+    static inline type load( const T* const ptr ){
+      type result;
+      for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) result[i] = ptr[i];
+      return result;
+    }
+    static inline void store( T* const ptr, const type value ){
+      for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) ptr[i] = value[i];
+    }
+  };
+
+  template<>
+  struct NeboSIMDPack<double> {
+    typedef NeboSIMDDouble type;
+    enum { vectorized = true };
+
+    static inline type broadcast( const double value ){
+      type result;
+      for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) result[i] = value;
+      return result;
+    }
+    // unaligned: rows start wherever the memory window puts them
+    static inline type load( const double* const ptr ){
+      type result;
+      std::memcpy( &result, ptr, sizeof(type) );
+      return result;
+    }
+    static inline void store( double* const ptr, const type value ){
+      std::memcpy( ptr, &value, sizeof(type) );
+    }
+  };
+
+  template<>
+  struct NeboSIMDPack<bool> {
+    typedef NeboSIMDMask type;
+    enum { vectorized = false };
+
+    static inline type broadcast( const bool value ){
+      type result;
+      for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) result[i] = value ? -1 : 0;
+      return result;
+    }
+  };
+
+  /**
+   * @brief Convert the pack produced by a boolean expression (a mask, or
+   * the 0/1 lanes of a NeboMask) into a mask.
+   */
+  inline NeboSIMDMask nebo_simd_test( const NeboSIMDMask mask ){ return mask; }
+  inline NeboSIMDMask nebo_simd_test( const NeboSIMDDouble value ){ return value != NeboSIMDPack<double>::broadcast(0.0); }
+
+  /*
+   * Functions without a packed instruction are applied lane by lane.  They
+   * call the same libm routines as the scalar modes, so SIMDWalk results
+   * are bitwise identical to SeqWalk results.
+   */
+# define NEBO_SIMD_LANEWISE_UNARY( NAME, FCN )                 \
+  inline NeboSIMDDouble NAME( const NeboSIMDDouble a ){          \
+    NeboSIMDDouble result;                                       \
+    for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) result[i] = FCN(a[i]); \
+    return result;                                               \
+  }
+
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_sin,   std::sin   )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_cos,   std::cos   )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_tan,   std::tan   )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_exp,   std::exp   )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_tanh,  std::tanh  )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_abs,   std::abs   )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_sqrt,  std::sqrt  )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_log,   std::log   )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_log10, std::log10 )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_erf,   erf        )
+  NEBO_SIMD_LANEWISE_UNARY( nebo_simd_erfc,  erfc       )
+
+# undef NEBO_SIMD_LANEWISE_UNARY
+
+  inline NeboSIMDDouble nebo_simd_pow( const NeboSIMDDouble a, const NeboSIMDDouble b ){
+    NeboSIMDDouble result;
+    for( int i=0; i<NEBO_SIMD_WIDTH; ++i ) result[i] = std::pow(a[i],b[i]);
+    return result;
+  }
+
+} // namespace SpatialOps
+
+#endif // Nebo_SIMD_h
@@ -52,8 +52,170 @@
 //Add a point (three constant integers) to an existing stencil
 #define NEBO_ADD_IJK(X, Y, Z) AddPoint< structured::IndexTriplet<X,Y,Z> >::Result
 
+//A stencil applied to a stencil (or sum stencil) is collapsed into a single stencil,
+//e.g. interp(grad(phi)) reads three points of phi rather than four.
+//This reorders the arithmetic, so results change by rounding;
+//define NEBO_COLLAPSE_STENCILS to 0 to evaluate the stencils one inside the other.
+#ifndef NEBO_COLLAPSE_STENCILS
+#  define NEBO_COLLAPSE_STENCILS 1
+#endif
+
 namespace SpatialOps {
 
+  //==================================================================
+  // Collapsing stencils of stencils
+  //
+  // A stencil applied to a stencil evaluates the inner stencil at each of its
+  // own points, so a chain of n two-point stencils loads 2^n values per point.
+  // Both stencils are linear, so the chain is itself a stencil: its points are
+  // the sums of an outer and an inner point, and the coefficient of a point is
+  // the sum of the products of the coefficients that reach it.  The points are
+  // merged at compile time and the coefficients when the expression is built.
+
+  /**
+   * \struct NeboStencilPointIndex
+   * \brief The index of the coefficient of \c Point in the point collection
+   *  \c Pts, or -1 if \c Pts does not have \c Point
+   */
+  template<typename Point, typename Pts>
+  struct NeboStencilPointIndex {
+      enum { value = NeboStencilPointIndex<Point, typename Pts::Collection>::value };
+  };
+
+  template<typename Point, typename Collection>
+  struct NeboStencilPointIndex<Point, NeboStencilPointCollection<Point, Collection> > {
+      enum { value = NeboStencilPointCollection<Point, Collection>::length - 1 };
+  };
+
+  template<typename Point>
+  struct NeboStencilPointIndex<Point, NeboNil> {
+      enum { value = -1 };
+  };
+
+  /**
+   * \struct NeboStencilPointUnion
+   * \brief The point collection \c Pts with \c Point added, unless \c Pts
+   *  already has it (NeboNil is the empty collection)
+   */
+  template<typename Pts, typename Point, bool Present = ((int)NeboStencilPointIndex<Point, Pts>::value >= 0)>
+  struct NeboStencilPointUnion {
+      typedef typename Pts::template AddPoint<Point>::Result Result;
+  };
+
+  template<typename Pts, typename Point>
+  struct NeboStencilPointUnion<Pts, Point, true> {
+      typedef Pts Result;
+  };
+
+  template<typename Point>
+  struct NeboStencilPointUnion<NeboNil, Point, false> {
+      typedef NeboStencilPointCollection<Point, NeboNil> Result;
+  };
+
+  /**
+   * \struct NeboStencilShiftedPoints
+   * \brief The points of \c Pts, and the points of \c Inner shifted by \c Point
+   */
+  template<typename Pts, typename Point, typename Inner>
+  struct NeboStencilShiftedPoints {
+      typedef typename NeboStencilShiftedPoints<Pts, Point, typename Inner::Collection>::Result Earlier;
+      typedef typename structured::Add<Point, typename Inner::Point>::result Shifted;
+      typedef typename NeboStencilPointUnion<Earlier, Shifted>::Result Result;
+
+      // adds the coefficients of Inner, times outer, to those of the shifted points
+      static inline void add_coefs( double * const coefs, const double outer, const double * const inner ) {
+          NeboStencilShiftedPoints<Pts, Point, typename Inner::Collection>::add_coefs(coefs, outer, inner);
+          coefs[NeboStencilPointIndex<Shifted, Pts>::value] += outer * inner[Inner::length - 1];
+      }
+  };
+
+  template<typename Pts, typename Point>
+  struct NeboStencilShiftedPoints<Pts, Point, NeboNil> {
+      typedef Pts Result;
+      static inline void add_coefs( double * const, const double, const double * const ) {}
+  };
+
+  /**
+   * \struct NeboStencilCollapsedPoints
+   * \brief The sums of the points of \c Outer and \c Inner, without repeats
+   *
+   * \c Pts is the collection being built; add_coefs() takes it to be the
+   * final one (so, Result).
+   */
+  template<typename Outer, typename Inner, typename Pts = NeboNil>
+  struct NeboStencilCollapsedPoints {
+      typedef typename NeboStencilCollapsedPoints<typename Outer::Collection, Inner, Pts>::Result Earlier;
+      typedef typename NeboStencilShiftedPoints<Earlier, typename Outer::Point, Inner>::Result Result;
+
+      static inline void add_coefs( double * const coefs, const double * const outer, const double * const inner ) {
+          NeboStencilCollapsedPoints<typename Outer::Collection, Inner, Pts>::add_coefs(coefs, outer, inner);
+          NeboStencilShiftedPoints<Pts, typename Outer::Point, Inner>::add_coefs(coefs, outer[Outer::length - 1], inner);
+      }
+  };
+
+  template<typename Inner, typename Pts>
+  struct NeboStencilCollapsedPoints<NeboNil, Inner, Pts> {
+      typedef NeboNil Result;
+      static inline void add_coefs( double * const, const double * const, const double * const ) {}
+  };
+
+  /**
+   * \struct NeboStencilCoefArray
+   * \brief Converts between a NeboStencilCoefCollection and an array of its coefficients
+   */
+  template<int Length>
+  struct NeboStencilCoefArray {
+      static inline NeboStencilCoefCollection<Length> build( const double * const coefs ) {
+          return NeboStencilCoefArray<Length - 1>::build(coefs)(coefs[Length - 1]);
+      }
+
+      static inline void get( const NeboStencilCoefCollection<Length> & collection, double * const coefs ) {
+          for( int i = 0; i < Length; i++ ) coefs[i] = collection.get_coef(i);
+      }
+
+      static inline void ones( double * const coefs ) {
+          for( int i = 0; i < Length; i++ ) coefs[i] = 1.0;
+      }
+  };
+
+  template<>
+  struct NeboStencilCoefArray<1> {
+      static inline NeboStencilCoefCollection<1> build( const double * const coefs ) {
+          return NeboStencilCoefCollection<1>(coefs[0]);
+      }
+
+      static inline void get( const NeboStencilCoefCollection<1> & collection, double * const coefs ) {
+          coefs[0] = collection.coef();
+      }
+
+      static inline void ones( double * const coefs ) {
+          coefs[0] = 1.0;
+      }
+  };
+
+  /**
+   * \struct NeboStencilCollapse
+   * \brief The single stencil equal to the stencil with points \c Outer
+   *  applied to the stencil with points \c Inner
+   */
+  template<typename Outer, typename Inner>
+  struct NeboStencilCollapse {
+      typedef typename NeboStencilCollapsedPoints<Outer, Inner>::Result Points; ///< collection of stencil points
+      typedef NeboStencilCoefCollection<Points::length> Coefs;                  ///< collection of coefficients
+
+      /**
+       * \brief The coefficients of the collapsed stencil
+       * \param outer the coefficients of the outer stencil, one per point of \c Outer
+       * \param inner the coefficients of the inner stencil, one per point of \c Inner
+       */
+      static inline Coefs coefs( const double * const outer, const double * const inner ) {
+          double coefs[Points::length];
+          for( int i = 0; i < Points::length; i++ ) coefs[i] = 0.0;
+          NeboStencilCollapsedPoints<Outer, Inner, Points>::add_coefs(coefs, outer, inner);
+          return NeboStencilCoefArray<Points::length>::build(coefs);
+      }
+  };
+
   /**
    * \struct NeboStencilBuilder
    * \brief Supports definition of new Nebo stencils.
@@ -104,9 +266,7 @@ namespace SpatialOps {
          * \param src the field that the operator is applied to
          * \param dest the resulting field.
          */
-        void apply_to_field( const SrcFieldType & src, DestFieldType & dest ) const {
-            dest <<= operator()(src);
-        }
+        void apply_to_field( const SrcFieldType & src, DestFieldType & dest ) const;
 
         /**
          * \brief Nebo's inline operator for field values
@@ -128,10 +288,61 @@ namespace SpatialOps {
             return Result(Stencil(src.expr(), coefs()));
         }
 
+#     if NEBO_COLLAPSE_STENCILS
+        // typedefs for when argument is a stencil with points InnerPts
+        template<typename InnerPts, typename InnerArg>
+        struct WithStencilArg {
+            typedef NeboStencilCollapse<PointCollectionType, InnerPts> Collapse;
+            typedef NeboStencil<Initial, typename Collapse::Points, InnerArg, DestFieldType> Stencil;
+            typedef NeboExpression<Stencil, DestFieldType> Result;
+        };
+
+        /**
+         * \brief Nebo's inline operator for stencils, which collapses this operator and the stencil into one stencil
+         * \param src the stencil to which the operator is applied
+         */
+        template<typename InnerPts, typename InnerArg>
+        inline typename WithStencilArg<InnerPts, InnerArg>::Result
+        operator ()( const NeboExpression<NeboStencil<Initial, InnerPts, InnerArg, SrcFieldType>, SrcFieldType> & src ) const {
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Collapse Collapse;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Stencil Stencil;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Result Result;
+            double outer[PointCollectionType::length];
+            double inner[InnerPts::length];
+            NeboStencilCoefArray<PointCollectionType::length>::get(coefs(), outer);
+            NeboStencilCoefArray<InnerPts::length>::get(src.expr().coefs(), inner);
+            return Result(Stencil(src.expr().arg(), Collapse::coefs(outer, inner)));
+        }
+
+        /**
+         * \brief Nebo's inline operator for sum stencils, which collapses this operator and the sum stencil into one stencil
+         * \param src the sum stencil to which the operator is applied
+         */
+        template<typename InnerPts, typename InnerArg>
+        inline typename WithStencilArg<InnerPts, InnerArg>::Result
+        operator ()( const NeboExpression<NeboSumStencil<Initial, InnerPts, InnerArg, SrcFieldType>, SrcFieldType> & src ) const {
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Collapse Collapse;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Stencil Stencil;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Result Result;
+            double outer[PointCollectionType::length];
+            double inner[InnerPts::length];
+            NeboStencilCoefArray<PointCollectionType::length>::get(coefs(), outer);
+            NeboStencilCoefArray<InnerPts::length>::ones(inner);
+            return Result(Stencil(src.expr().arg(), Collapse::coefs(outer, inner)));
+        }
+#     endif
+
     private:
         const CoefCollection coefCollection_;
     };
 
+    // not inline, so that the operators instantiated in spatialops-stencil
+    // (see SO_BUILD_STENCILS_OPERATORS) are not compiled again where they are applied
+    template<typename OperatorType, typename PntCltnT, typename SrcFieldT, typename DestFieldT>
+    void NeboStencilBuilder<OperatorType, PntCltnT, SrcFieldT, DestFieldT>::apply_to_field( const SrcFieldT & src, DestFieldT & dest ) const {
+        dest <<= operator()(src);
+    }
+
     template<typename OperatorType, typename SrcFieldType, typename DestFieldType>
     struct Stencil2Collection {
         // source field offset
@@ -253,9 +464,7 @@ namespace SpatialOps {
          * \param src the field that the operator is applied to
          * \param dest the resulting field.
          */
-        void apply_to_field( const SrcFieldType & src, DestFieldType & dest ) const {
-            dest <<= operator()(src);
-        }
+        void apply_to_field( const SrcFieldType & src, DestFieldType & dest ) const;
 
         /**
          * \brief Nebo's inline operator for field values
@@ -276,8 +485,57 @@ namespace SpatialOps {
             typedef typename WithArg<Arg>::Result Result;
             return Result(Stencil(src.expr()));
         }
+
+#     if NEBO_COLLAPSE_STENCILS
+        // typedefs for when argument is a stencil with points InnerPts
+        template<typename InnerPts, typename InnerArg>
+        struct WithStencilArg {
+            typedef NeboStencilCollapse<PointCollectionType, InnerPts> Collapse;
+            typedef NeboStencil<Initial, typename Collapse::Points, InnerArg, DestFieldType> Stencil;
+            typedef NeboExpression<Stencil, DestFieldType> Result;
+        };
+
+        /**
+         * \brief Nebo's inline operator for stencils, which collapses this operator and the stencil into one stencil
+         * \param src the stencil to which the operator is applied
+         */
+        template<typename InnerPts, typename InnerArg>
+        inline typename WithStencilArg<InnerPts, InnerArg>::Result
+        operator ()( const NeboExpression<NeboStencil<Initial, InnerPts, InnerArg, SrcFieldType>, SrcFieldType> & src ) const {
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Collapse Collapse;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Stencil Stencil;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Result Result;
+            double outer[PointCollectionType::length];
+            double inner[InnerPts::length];
+            NeboStencilCoefArray<PointCollectionType::length>::ones(outer);
+            NeboStencilCoefArray<InnerPts::length>::get(src.expr().coefs(), inner);
+            return Result(Stencil(src.expr().arg(), Collapse::coefs(outer, inner)));
+        }
+
+        /**
+         * \brief Nebo's inline operator for sum stencils, which collapses this operator and the sum stencil into one stencil
+         * \param src the sum stencil to which the operator is applied
+         */
+        template<typename InnerPts, typename InnerArg>
+        inline typename WithStencilArg<InnerPts, InnerArg>::Result
+        operator ()( const NeboExpression<NeboSumStencil<Initial, InnerPts, InnerArg, SrcFieldType>, SrcFieldType> & src ) const {
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Collapse Collapse;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Stencil Stencil;
+            typedef typename WithStencilArg<InnerPts, InnerArg>::Result Result;
+            double outer[PointCollectionType::length];
+            double inner[InnerPts::length];
+            NeboStencilCoefArray<PointCollectionType::length>::ones(outer);
+            NeboStencilCoefArray<InnerPts::length>::ones(inner);
+            return Result(Stencil(src.expr().arg(), Collapse::coefs(outer, inner)));
+        }
+#     endif
     };
 
+    template<typename PntCltnT, typename SrcFieldT, typename DestFieldT>
+    void NeboSumStencilBuilder<PntCltnT, SrcFieldT, DestFieldT>::apply_to_field( const SrcFieldT & src, DestFieldT & dest ) const {
+        dest <<= operator()(src);
+    }
+
     struct NullStencilCollection {
         typedef NEBO_FIRST_IJK(0, 0, 0) StPtCollection;
     };
@@ -326,9 +584,7 @@ namespace SpatialOps {
          * \param src the field that the operator is applied to
          * \param dest the resulting field.
          */
-        void apply_to_field( const SrcFieldType & src, DestFieldType & dest ) const {
-            dest <<= operator()(src);
-        }
+        void apply_to_field( const SrcFieldType & src, DestFieldType & dest ) const;
 
         /**
          * \brief Nebo's inline operator for field values
@@ -355,6 +611,11 @@ namespace SpatialOps {
         }
     };
 
+    template<typename PntCltnT, typename SrcFieldT, typename DestFieldT>
+    void NeboAverageStencilBuilder<PntCltnT, SrcFieldT, DestFieldT>::apply_to_field( const SrcFieldT & src, DestFieldT & dest ) const {
+        dest <<= operator()(src);
+    }
+
     struct BoxFilter3DStencilCollection {
       typedef NEBO_FIRST_IJK(-1,-1,-1)::NEBO_ADD_IJK( 0,-1,-1)::NEBO_ADD_IJK( 1,-1,-1)
               ::NEBO_ADD_IJK(-1, 0,-1)::NEBO_ADD_IJK( 0, 0,-1)::NEBO_ADD_IJK( 1, 0,-1)
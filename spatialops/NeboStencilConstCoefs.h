@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_Stencil_Const_Coefs_h
+#define Nebo_Stencil_Const_Coefs_h
+
+#include <spatialops/NeboBasic.h>
+#include <spatialops/NeboRhs.h>
+#include <spatialops/NeboOperators.h>
+#include <spatialops/NeboStencils.h>
+#include <spatialops/NeboStencilBuilder.h>
+
+/**
+ * \file NeboStencilConstCoefs.h
+ *
+ * Stencils with compile-time coefficients.  The coefficients of a
+ * NeboStencilCoefCollection are doubles, copied into each walk, so every
+ * point of a stencil loads and multiplies by them, even when they are
+ * constants like the 0.5 of a two-point interpolant.  The points of a
+ * NeboStencilConstCoefPointCollection each carry a rational coefficient in
+ * their type, and stencils on them multiply by literal constants that the
+ * compiler folds into the arithmetic.  For example, a three-point average:
+ *
+ * \code
+ *   typedef NeboStencilUniformCoefPoints<BoxFilter1DXStencilCollection::StPtCollection,
+ *                                        NeboStencilConstCoef<1,3> >::Result Points;
+ *   const NeboConstCoefStencilBuilder<Filter, Points, SVolField, SVolField> average;
+ *   dest <<= average( src );
+ * \endcode
+ *
+ * ConstCoefOperatorTypeBuilder (FVStaggeredOperatorTypes.h) gives such
+ * builders for the interpolants.  These builders have no state, so they need
+ * not come from an OperatorDatabase.  They collapse with other stencils (see
+ * NEBO_COLLAPSE_STENCILS) like any stencil, into a stencil with runtime
+ * coefficients.
+ */
+
+namespace SpatialOps{
+
+  /**
+   * @struct NeboStencilConstCoef
+   * @brief The stencil coefficient \c Numerator / \c Denominator
+   */
+  template<int Numerator, int Denominator = 1>
+  struct NeboStencilConstCoef{
+    enum { numerator = Numerator, denominator = Denominator };
+
+    static inline double value(){ return double(Numerator) / double(Denominator); }
+  };
+
+  //==================================================================
+  // NeboConstCoefScalar: the coefficient of a point, in a walk
+
+  template<typename CurrentMode, typename AtomicType, typename Coef>
+  struct NeboConstCoefScalar;
+
+  template<typename AtomicType, typename Coef>
+  struct NeboConstCoefScalar<SeqWalk, AtomicType, Coef>{
+  public:
+    AtomicType typedef value_type;
+
+    inline value_type eval( const int x, const int y, const int z ) const{
+      return value_type(Coef::numerator) / value_type(Coef::denominator);
+    }
+  };
+
+#ifdef NEBO_SIMD
+  template<typename AtomicType, typename Coef>
+  struct NeboConstCoefScalar<SIMDWalk, AtomicType, Coef>{
+  public:
+    AtomicType typedef value_type;
+    typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+    inline value_type eval( const int x, const int y, const int z ) const{
+      return value_type(Coef::numerator) / value_type(Coef::denominator);
+    }
+
+    inline pack_type pack_eval( const int x, const int y, const int z ) const{
+      return NeboSIMDPack<value_type>::broadcast( value_type(Coef::numerator) / value_type(Coef::denominator) );
+    }
+  };
+#endif // NEBO_SIMD
+
+#ifdef __CUDACC__
+  template<typename AtomicType, typename Coef>
+  struct NeboConstCoefScalar<GPUWalk, AtomicType, Coef>{
+  public:
+    AtomicType typedef value_type;
+
+    __device__ inline void start( int x, int y ){}
+
+    __device__ inline void next(){}
+
+    __device__ inline value_type eval() const{
+      return value_type(Coef::numerator) / value_type(Coef::denominator);
+    }
+  };
+#endif // __CUDACC__
+
+  template<typename AtomicType, typename Coef>
+  struct NeboConstCoefScalar<Reduction, AtomicType, Coef>{
+  public:
+    AtomicType typedef value_type;
+
+    inline void next(){}
+
+    inline bool at_end() const{ return false; }
+
+    inline bool has_length() const{ return false; }
+
+    inline value_type eval() const{
+      return value_type(Coef::numerator) / value_type(Coef::denominator);
+    }
+  };
+
+  //==================================================================
+  // Point collections with compile-time coefficients
+
+  /**
+   * @struct NeboStencilConstCoefPointCollection
+   * @brief A stencil point collection whose points each have a coefficient
+   *  known at compile time (a NeboStencilConstCoef)
+   *
+   * It can be used wherever a NeboStencilPointCollection can be, with
+   * coefs() as the coefficient collection.  Stencils built on it ignore the
+   * values in their coefficient collection, and multiply by \c Coef instead.
+   *
+   * \tparam PointType      the last point (an IndexTriplet)
+   * \tparam CoefType       its coefficient
+   * \tparam CollectionType the earlier points (NeboNil for none)
+   */
+  template<typename PointType, typename CoefType, typename CollectionType>
+  struct NeboStencilConstCoefPointCollection{
+  public:
+    PointType typedef Point;
+    CoefType typedef Coef;
+    CollectionType typedef Collection;
+    NeboStencilConstCoefPointCollection<Point, Coef, Collection> typedef MyType;
+
+    enum { length = 1 + Collection::length };
+
+    template<typename NewPoint, typename NewCoef>
+    struct AddPoint{
+      NeboStencilConstCoefPointCollection<NewPoint, NewCoef, MyType> typedef Result;
+    };
+
+    static inline structured::GhostData possible_ghosts( const structured::GhostData& ghosts ){
+      return min( ghosts - point_to_ghost(Point::int_vec()),
+                  Collection::possible_ghosts(ghosts) );
+    }
+
+    /**
+     * @brief The coefficients, as a NeboStencilCoefCollection
+     */
+    static inline NeboStencilCoefCollection<length> coefs(){
+      return Collection::coefs()( Coef::value() );
+    }
+
+    template<typename PreArg, typename DestType>
+    struct ConstructExpr{
+      NeboConstCoefScalar<SeqWalk, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<SeqWalk, typename PreArg::SeqWalkType, Scalar> typedef MultiplyType;
+      typename Collection::template ConstructExpr<PreArg, DestType> typedef EarlierPointsType;
+      SumOp<SeqWalk, typename EarlierPointsType::Result, MultiplyType> typedef Result;
+
+      static inline const Result in_sq_construct( const structured::IntVec& minus,
+                                                  const structured::IntVec& plus,
+                                                  const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<length>& coefs ){
+        return Result( EarlierPointsType::in_sq_construct( minus, plus, shift, arg, coefs.others() ),
+                       MultiplyType( arg.init( minus, plus, shift + Point::int_vec() ), Scalar() ) );
+      }
+
+      static inline const Result rs_sq_construct( const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<length>& coefs,
+                                                  const structured::IntVec& split,
+                                                  const structured::IntVec& location ){
+        return Result( EarlierPointsType::rs_sq_construct( shift, arg, coefs.others(), split, location ),
+                       MultiplyType( arg.init( shift + Point::int_vec(), split, location ), Scalar() ) );
+      }
+    };
+
+#   ifdef __CUDACC__
+    template<typename PreArg, typename DestType>
+    struct ConstructGPUExpr{
+      NeboConstCoefScalar<GPUWalk, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<GPUWalk, typename PreArg::GPUWalkType, Scalar> typedef MultiplyType;
+      typename Collection::template ConstructGPUExpr<PreArg, DestType> typedef EarlierPointsType;
+      SumOp<GPUWalk, typename EarlierPointsType::Result, MultiplyType> typedef Result;
+
+      static inline const Result in_gpu_construct( const structured::IntVec& minus,
+                                                   const structured::IntVec& plus,
+                                                   const structured::IntVec& shift,
+                                                   const PreArg& arg,
+                                                   const NeboStencilCoefCollection<length>& coefs,
+                                                   const int deviceIndex ){
+        return Result( EarlierPointsType::in_gpu_construct( minus, plus, shift, arg, coefs.others(), deviceIndex ),
+                       MultiplyType( arg.gpu_init( minus, plus, shift + Point::int_vec(), deviceIndex ), Scalar() ) );
+      }
+    };
+#   endif // __CUDACC__
+
+#   ifdef NEBO_SIMD
+    template<typename PreArg, typename DestType>
+    struct ConstructSIMDExpr{
+      NeboConstCoefScalar<SIMDWalk, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<SIMDWalk, typename PreArg::SIMDWalkType, Scalar> typedef MultiplyType;
+      typename Collection::template ConstructSIMDExpr<PreArg, DestType> typedef EarlierPointsType;
+      SumOp<SIMDWalk, typename EarlierPointsType::Result, MultiplyType> typedef Result;
+
+      static inline const Result in_simd_construct( const structured::IntVec& minus,
+                                                    const structured::IntVec& plus,
+                                                    const structured::IntVec& shift,
+                                                    const PreArg& arg,
+                                                    const NeboStencilCoefCollection<length>& coefs ){
+        return Result( EarlierPointsType::in_simd_construct( minus, plus, shift, arg, coefs.others() ),
+                       MultiplyType( arg.simd_init( minus, plus, shift + Point::int_vec() ), Scalar() ) );
+      }
+    };
+#   endif // NEBO_SIMD
+
+    template<typename PreArg, typename DestType>
+    struct ConstructReductionExpr{
+      NeboConstCoefScalar<Reduction, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<Reduction, typename PreArg::ReductionType, Scalar> typedef MultiplyType;
+      typename Collection::template ConstructReductionExpr<PreArg, DestType> typedef EarlierPointsType;
+      SumOp<Reduction, typename EarlierPointsType::Result, MultiplyType> typedef Result;
+
+      static inline const Result in_rd_construct( const structured::IntVec& minus,
+                                                  const structured::IntVec& plus,
+                                                  const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<length>& coefs ){
+        return Result( EarlierPointsType::in_rd_construct( minus, plus, shift, arg, coefs.others() ),
+                       MultiplyType( arg.reduce_init( minus, plus, shift + Point::int_vec() ), Scalar() ) );
+      }
+
+      static inline const Result rs_rd_construct( const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<length>& coefs,
+                                                  const structured::IntVec& split,
+                                                  const structured::IntVec& location ){
+        return Result( EarlierPointsType::rs_rd_construct( shift, arg, coefs.others(), split, location ),
+                       MultiplyType( arg.reduce_init( shift + Point::int_vec(), split, location ), Scalar() ) );
+      }
+    };
+  };
+
+  template<typename PointType, typename CoefType>
+  struct NeboStencilConstCoefPointCollection<PointType, CoefType, NeboNil>{
+  public:
+    PointType typedef Point;
+    CoefType typedef Coef;
+    NeboNil typedef Collection;
+    NeboStencilConstCoefPointCollection<Point, Coef, Collection> typedef MyType;
+
+    enum { length = 1 };
+
+    template<typename NewPoint, typename NewCoef>
+    struct AddPoint{
+      NeboStencilConstCoefPointCollection<NewPoint, NewCoef, MyType> typedef Result;
+    };
+
+    static inline structured::GhostData possible_ghosts( const structured::GhostData& ghosts ){
+      return ghosts - point_to_ghost(Point::int_vec());
+    }
+
+    static inline NeboStencilCoefCollection<1> coefs(){
+      return NeboStencilCoefCollection<1>( Coef::value() );
+    }
+
+    template<typename PreArg, typename DestType>
+    struct ConstructExpr{
+      NeboConstCoefScalar<SeqWalk, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<SeqWalk, typename PreArg::SeqWalkType, Scalar> typedef Result;
+
+      static inline const Result in_sq_construct( const structured::IntVec& minus,
+                                                  const structured::IntVec& plus,
+                                                  const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<1>& ){
+        return Result( arg.init( minus, plus, shift + Point::int_vec() ), Scalar() );
+      }
+
+      static inline const Result rs_sq_construct( const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<1>&,
+                                                  const structured::IntVec& split,
+                                                  const structured::IntVec& location ){
+        return Result( arg.init( shift + Point::int_vec(), split, location ), Scalar() );
+      }
+    };
+
+#   ifdef __CUDACC__
+    template<typename PreArg, typename DestType>
+    struct ConstructGPUExpr{
+      NeboConstCoefScalar<GPUWalk, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<GPUWalk, typename PreArg::GPUWalkType, Scalar> typedef Result;
+
+      static inline const Result in_gpu_construct( const structured::IntVec& minus,
+                                                   const structured::IntVec& plus,
+                                                   const structured::IntVec& shift,
+                                                   const PreArg& arg,
+                                                   const NeboStencilCoefCollection<1>&,
+                                                   const int deviceIndex ){
+        return Result( arg.gpu_init( minus, plus, shift + Point::int_vec(), deviceIndex ), Scalar() );
+      }
+    };
+#   endif // __CUDACC__
+
+#   ifdef NEBO_SIMD
+    template<typename PreArg, typename DestType>
+    struct ConstructSIMDExpr{
+      NeboConstCoefScalar<SIMDWalk, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<SIMDWalk, typename PreArg::SIMDWalkType, Scalar> typedef Result;
+
+      static inline const Result in_simd_construct( const structured::IntVec& minus,
+                                                    const structured::IntVec& plus,
+                                                    const structured::IntVec& shift,
+                                                    const PreArg& arg,
+                                                    const NeboStencilCoefCollection<1>& ){
+        return Result( arg.simd_init( minus, plus, shift + Point::int_vec() ), Scalar() );
+      }
+    };
+#   endif // NEBO_SIMD
+
+    template<typename PreArg, typename DestType>
+    struct ConstructReductionExpr{
+      NeboConstCoefScalar<Reduction, typename DestType::value_type, Coef> typedef Scalar;
+      ProdOp<Reduction, typename PreArg::ReductionType, Scalar> typedef Result;
+
+      static inline const Result in_rd_construct( const structured::IntVec& minus,
+                                                  const structured::IntVec& plus,
+                                                  const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<1>& ){
+        return Result( arg.reduce_init( minus, plus, shift + Point::int_vec() ), Scalar() );
+      }
+
+      static inline const Result rs_rd_construct( const structured::IntVec& shift,
+                                                  const PreArg& arg,
+                                                  const NeboStencilCoefCollection<1>&,
+                                                  const structured::IntVec& split,
+                                                  const structured::IntVec& location ){
+        return Result( arg.reduce_init( shift + Point::int_vec(), split, location ), Scalar() );
+      }
+    };
+  };
+
+  /**
+   * @struct NeboStencilUniformCoefPoints
+   * @brief The points of the NeboStencilPointCollection \c Pts, each with the
+   *  coefficient \c Coef
+   */
+  template<typename Pts, typename Coef>
+  struct NeboStencilUniformCoefPoints{
+    NeboStencilConstCoefPointCollection<typename Pts::Point,
+                                        Coef,
+                                        typename NeboStencilUniformCoefPoints<typename Pts::Collection, Coef>::Result>
+            typedef Result;
+  };
+
+  template<typename Coef>
+  struct NeboStencilUniformCoefPoints<NeboNil, Coef>{
+    NeboNil typedef Result;
+  };
+
+  /**
+   * @struct NeboConstCoefStencilBuilder
+   * @brief A NeboStencilBuilder with compile-time coefficients
+   *
+   * \tparam OperatorT  the type of operator (\c Interpolant, ...)
+   * \tparam PntCltnT   the stencil points and their coefficients (a NeboStencilConstCoefPointCollection)
+   * \tparam SrcFieldT  the type of field that this operator acts on
+   * \tparam DestFieldT the type of field that this operator produces
+   */
+  template<typename OperatorT, typename PntCltnT, typename SrcFieldT, typename DestFieldT>
+  struct NeboConstCoefStencilBuilder
+    : public NeboStencilBuilder<OperatorT, PntCltnT, SrcFieldT, DestFieldT>
+  {
+    NeboConstCoefStencilBuilder()
+      : NeboStencilBuilder<OperatorT, PntCltnT, SrcFieldT, DestFieldT>( PntCltnT::coefs() )
+    {}
+  };
+
+} // namespace SpatialOps
+
+#endif // Nebo_Stencil_Const_Coefs_h
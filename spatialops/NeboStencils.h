@@ -270,6 +270,47 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             template<typename PreArg, typename DestType>
+              struct ConstructSIMDExpr {
+                NeboScalar<SIMDWalk, typename DestType::value_type> typedef Coef;
+
+                typename PreArg::SIMDWalkType typedef Arg;
+
+                ProdOp<SIMDWalk, Arg, Coef> typedef MultiplyType;
+
+                typename Collection::template ConstructSIMDExpr<PreArg, DestType>
+                typedef EarlierPointsType;
+
+                typename EarlierPointsType::Result typedef EarlierPointsResult;
+
+                SumOp<SIMDWalk, EarlierPointsResult, MultiplyType> typedef Result
+                ;
+
+                static inline Result const in_simd_construct(structured::IntVec
+                                                             const & minus,
+                                                             structured::IntVec
+                                                             const & plus,
+                                                             structured::IntVec
+                                                             const & shift,
+                                                             PreArg const & arg,
+                                                             NeboStencilCoefCollection<length>
+                                                             const & coefs) {
+                   return Result(EarlierPointsType::in_simd_construct(minus,
+                                                                      plus,
+                                                                      shift,
+                                                                      arg,
+                                                                      coefs.others()),
+                                 MultiplyType(arg.simd_init(minus,
+                                                            plus,
+                                                            shift + Point::
+                                                            int_vec()),
+                                              Coef(coefs.coef())));
+                }
+             };
+          #endif
+          /* NEBO_SIMD */
+
           template<typename PreArg, typename DestType>
            struct ConstructReductionExpr {
              NeboScalar<Reduction, typename DestType::value_type> typedef Coef;
@@ -405,6 +446,38 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             template<typename PreArg, typename DestType>
+              struct SumConstructSIMDExpr {
+                typename PreArg::SIMDWalkType typedef Arg;
+
+                typename Collection::template SumConstructSIMDExpr<PreArg,
+                                                                  DestType>
+                typedef EarlierPointsType;
+
+                typename EarlierPointsType::Result typedef EarlierPointsResult;
+
+                SumOp<SIMDWalk, EarlierPointsResult, Arg> typedef Result;
+
+                static inline Result const in_simd_construct(structured::IntVec
+                                                             const & minus,
+                                                             structured::IntVec
+                                                             const & plus,
+                                                             structured::IntVec
+                                                             const & shift,
+                                                             PreArg const & arg) {
+                   return Result(EarlierPointsType::in_simd_construct(minus,
+                                                                      plus,
+                                                                      shift,
+                                                                      arg),
+                                 arg.simd_init(minus,
+                                               plus,
+                                               shift + Point::int_vec()));
+                }
+             };
+          #endif
+          /* NEBO_SIMD */
+
           template<typename PreArg, typename DestType>
            struct SumConstructReductionExpr {
              typename PreArg::ReductionType typedef Arg;
@@ -538,6 +611,33 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             template<typename PreArg, typename DestType>
+              struct ConstructSIMDExpr {
+                NeboScalar<SIMDWalk, typename DestType::value_type> typedef Coef;
+
+                typename PreArg::SIMDWalkType typedef Arg;
+
+                ProdOp<SIMDWalk, Arg, Coef> typedef Result;
+
+                static inline Result const in_simd_construct(structured::IntVec
+                                                             const & minus,
+                                                             structured::IntVec
+                                                             const & plus,
+                                                             structured::IntVec
+                                                             const & shift,
+                                                             PreArg const & arg,
+                                                             NeboStencilCoefCollection<1>
+                                                             const & coefs) {
+                   return Result(arg.simd_init(minus,
+                                               plus,
+                                               shift + Point::int_vec()),
+                                 Coef(coefs.coef()));
+                }
+             };
+          #endif
+          /* NEBO_SIMD */
+
           template<typename PreArg, typename DestType>
            struct ConstructReductionExpr {
              NeboScalar<Reduction, typename DestType::value_type> typedef Coef;
@@ -629,6 +729,28 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             template<typename PreArg, typename DestType>
+              struct SumConstructSIMDExpr {
+                typename PreArg::SIMDWalkType typedef Arg;
+
+                Arg typedef Result;
+
+                static inline Result const in_simd_construct(structured::IntVec
+                                                             const & minus,
+                                                             structured::IntVec
+                                                             const & plus,
+                                                             structured::IntVec
+                                                             const & shift,
+                                                             PreArg const & arg) {
+                   return arg.simd_init(minus,
+                                        plus,
+                                        shift + Point::int_vec());
+                }
+             };
+          #endif
+          /* NEBO_SIMD */
+
           template<typename PreArg, typename DestType>
            struct SumConstructReductionExpr {
              typename PreArg::ReductionType typedef Arg;
@@ -681,6 +803,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             typename Pts::template ConstructSIMDExpr<Arg, FieldType> typedef
+             ConstructSIMDExpr;
+             typename ConstructSIMDExpr::Result typedef ArgSIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           typename Pts::template ConstructReductionExpr<Arg, FieldType> typedef
           ConstructReductionExpr;
 
@@ -701,6 +830,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboStencil<SIMDWalk, Pts, ArgSIMDWalkType, FieldType> typedef
+             SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboStencil<Reduction, Pts, ArgReductionType, FieldType> typedef
           ReductionType;
 
@@ -712,6 +847,11 @@
              return Pts::possible_ghosts(arg_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return arg_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -722,6 +862,19 @@
                                                                coefs_));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(ConstructSIMDExpr::in_simd_construct(minus,
+                                                                         plus,
+                                                                         shift,
+                                                                         arg_,
+                                                                         coefs_));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -768,6 +921,10 @@
                                                                      coefs_));
           }
 
+          inline Arg const & arg(void) const { return arg_; }
+
+          inline Coefs const & coefs(void) const { return coefs_; }
+
          private:
           Arg const arg_;
 
@@ -821,13 +978,44 @@
           : arg_(arg)
           {}
 
-          inline void next(void) { arg_.next(); }
-
-          inline value_type eval(void) const { return arg_.eval(); }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return arg_.eval(x, y, z);
+          }
 
          private:
           Arg arg_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Pts, typename Arg, typename FieldType>
+          struct NeboStencil<SIMDWalk, Pts, Arg, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboStencil(Arg const & arg)
+             : arg_(arg)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return arg_.eval(x, y, z);
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return arg_.pack_eval(x, y, z);
+             }
+
+            private:
+             Arg arg_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Pts, typename Arg, typename FieldType>
           struct NeboStencil<GPUWalk, Pts, Arg, FieldType> {
@@ -898,6 +1086,13 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             typename Pts::template SumConstructSIMDExpr<Arg, FieldType> typedef
+             ConstructSIMDExpr;
+             typename ConstructSIMDExpr::Result typedef ArgSIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           typename Pts::template SumConstructReductionExpr<Arg, FieldType>
           typedef ConstructReductionExpr;
 
@@ -918,6 +1113,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboSumStencil<SIMDWalk, Pts, ArgSIMDWalkType, FieldType> typedef
+             SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboSumStencil<Reduction, Pts, ArgReductionType, FieldType> typedef
           ReductionType;
 
@@ -929,6 +1130,11 @@
              return Pts::possible_ghosts(arg_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return arg_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
@@ -938,6 +1144,18 @@
                                                                arg_));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(ConstructSIMDExpr::in_simd_construct(minus,
+                                                                         plus,
+                                                                         shift,
+                                                                         arg_));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -982,6 +1200,8 @@
                                                                      arg_));
           }
 
+          inline Arg const & arg(void) const { return arg_; }
+
          private:
           Arg const arg_;
       };
@@ -1028,13 +1248,44 @@
           : arg_(arg)
           {}
 
-          inline void next(void) { arg_.next(); }
-
-          inline value_type eval(void) const { return arg_.eval(); }
+          inline value_type eval(int const x, int const y, int const z) const {
+             return arg_.eval(x, y, z);
+          }
 
          private:
           Arg arg_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Pts, typename Arg, typename FieldType>
+          struct NeboSumStencil<SIMDWalk, Pts, Arg, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             typename NeboSIMDPack<value_type>::type typedef pack_type;
+
+             NeboSumStencil(Arg const & arg)
+             : arg_(arg)
+             {}
+
+             inline value_type eval(int const x,
+                                    int const y,
+                                    int const z) const {
+                return arg_.eval(x, y, z);
+             }
+
+             inline pack_type pack_eval(int const x,
+                                        int const y,
+                                        int const z) const {
+                return arg_.pack_eval(x, y, z);
+             }
+
+            private:
+             Arg arg_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Pts, typename Arg, typename FieldType>
           struct NeboSumStencil<GPUWalk, Pts, Arg, FieldType> {
@@ -1107,6 +1358,11 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             typename Arg::SIMDWalkType typedef ArgSIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           typename Arg::ReductionType typedef ArgReductionType;
 
           NeboMaskShift<SeqWalk, Point, ArgSeqWalkType, FieldType> typedef
@@ -1124,6 +1380,12 @@
           #endif
           /* __CUDACC__ */
 
+          #ifdef NEBO_SIMD
+             NeboMaskShift<SIMDWalk, Point, ArgSIMDWalkType, FieldType> typedef
+             SIMDWalkType;
+          #endif
+          /* NEBO_SIMD */
+
           NeboMaskShift<Reduction, Point, ArgReductionType, FieldType> typedef
           ReductionType;
 
@@ -1135,12 +1397,26 @@
              return point_possible_ghosts<Point>(arg_.possible_ghosts());
           }
 
+          inline structured::IntVec extent(structured::IntVec const & minus,
+                                           structured::IntVec const & plus) const {
+             return arg_.extent(minus, plus);
+          }
+
           inline SeqWalkType init(structured::IntVec const & minus,
                                   structured::IntVec const & plus,
                                   structured::IntVec const & shift) const {
              return SeqWalkType(arg_.init(minus, plus, shift + Point::int_vec()));
           }
 
+          #ifdef NEBO_SIMD
+             inline SIMDWalkType simd_init(structured::IntVec const & minus,
+                                           structured::IntVec const & plus,
+                                           structured::IntVec const & shift) const {
+                return SIMDWalkType(arg_.simd_init(minus, plus, shift + Point::int_vec()));
+             }
+          #endif
+          /* NEBO_SIMD */
+
           #ifdef FIELD_EXPRESSION_THREADS
              inline ResizeType resize(structured::IntVec const & minus,
                                       structured::IntVec const & plus) const {
@@ -1225,13 +1501,40 @@
           : arg_(arg)
           {}
 
-          inline void next(void) { arg_.next(); }
-
-          inline bool eval(void) const { return arg_.eval(); }
+          inline bool eval(int const x, int const y, int const z) const {
+             return arg_.eval(x, y, z);
+          }
 
          private:
           Arg arg_;
       };
+      #ifdef NEBO_SIMD
+         template<typename Point, typename Arg, typename FieldType>
+          struct NeboMaskShift<SIMDWalk, Point, Arg, FieldType> {
+            public:
+             FieldType typedef field_type;
+
+             typename field_type::value_type typedef value_type;
+
+             NeboMaskShift(Arg const & arg)
+             : arg_(arg)
+             {}
+
+             inline bool eval(int const x, int const y, int const z) const {
+                return arg_.eval(x, y, z);
+             }
+
+             inline NeboSIMDMask pack_eval(int const x,
+                                           int const y,
+                                           int const z) const {
+                return arg_.pack_eval(x, y, z);
+             }
+
+            private:
+             Arg arg_;
+         }
+      #endif
+      /* NEBO_SIMD */;
       #ifdef __CUDACC__
          template<typename Point, typename Arg, typename FieldType>
           struct NeboMaskShift<GPUWalk, Point, Arg, FieldType> {
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef Nebo_Tiling_h
+#define Nebo_Tiling_h
+
+#include <cstddef>
+
+#include <spatialops/structured/IndexTriplet.h>
+
+/*
+ * Bytes of source rows that a tile of a stencil assignment should keep in
+ * cache (about the size of a per-core L2 cache).  Defining it to 0 turns
+ * tiling off.
+ */
+#ifndef NEBO_TILE_BYTES
+#  define NEBO_TILE_BYTES (256*1024)
+#endif
+
+namespace SpatialOps{
+
+  struct NeboNil;
+  template<typename PointType, typename CollectionType> struct NeboStencilPointCollection;
+  template<typename CurrentMode, typename Pts, typename Arg, typename FieldType> struct NeboStencil;
+  template<typename CurrentMode, typename Pts, typename Arg, typename FieldType> struct NeboSumStencil;
+  template<typename CurrentMode, typename Point, typename Arg, typename FieldType> struct NeboMaskShift;
+
+  /**
+   * @struct NeboStencilReach
+   * @brief How far (in points) evaluating the Nebo expression \c Expr at a
+   *  point may read from that point in each direction: \c x, \c y and \c z.
+   *
+   * Nested stencils add up; the operands of other nodes take the maximum.
+   * This holds in every mode, since the stencil nodes keep their points.
+   * Expression nodes are recognized by shape: the template arguments of any
+   * class template with up to five type parameters are searched.
+   */
+  template<typename Expr>
+  struct NeboStencilReach{ enum { x = 0, y = 0, z = 0 }; };
+
+  template<int i, int j> struct NeboReachMax{ enum { result = i > j ? i : j }; };
+
+  template<typename A, typename B>
+  struct NeboReachOfBoth{
+    enum { x = NeboReachMax<NeboStencilReach<A>::x, NeboStencilReach<B>::x>::result,
+           y = NeboReachMax<NeboStencilReach<A>::y, NeboStencilReach<B>::y>::result,
+           z = NeboReachMax<NeboStencilReach<A>::z, NeboStencilReach<B>::z>::result };
+  };
+
+  template<typename Point, typename Arg>
+  struct NeboReachBeyond{
+    enum { x = NeboStencilReach<Point>::x + NeboStencilReach<Arg>::x,
+           y = NeboStencilReach<Point>::y + NeboStencilReach<Arg>::y,
+           z = NeboStencilReach<Point>::z + NeboStencilReach<Arg>::z };
+  };
+
+  template<int i, int j, int k>
+  struct NeboStencilReach< structured::IndexTriplet<i,j,k> >{
+    enum { x = structured::Abs<i>::result, y = structured::Abs<j>::result, z = structured::Abs<k>::result };
+  };
+
+  template<typename Point, typename Collection>
+  struct NeboStencilReach< NeboStencilPointCollection<Point,Collection> > : NeboReachOfBoth<Point,Collection> {};
+
+  template<typename Mode, typename Pts, typename Arg, typename FieldType>
+  struct NeboStencilReach< NeboStencil<Mode,Pts,Arg,FieldType> > : NeboReachBeyond<Pts,Arg> {};
+  template<typename Mode, typename Pts, typename Arg, typename FieldType>
+  struct NeboStencilReach< NeboSumStencil<Mode,Pts,Arg,FieldType> > : NeboReachBeyond<Pts,Arg> {};
+  template<typename Mode, typename Point, typename Arg, typename FieldType>
+  struct NeboStencilReach< NeboMaskShift<Mode,Point,Arg,FieldType> > : NeboReachBeyond<Point,Arg> {};
+
+  template<template<typename> class Node, typename A>
+  struct NeboStencilReach< Node<A> > : NeboStencilReach<A> {};
+  template<template<typename,typename> class Node, typename A, typename B>
+  struct NeboStencilReach< Node<A,B> > : NeboReachOfBoth<A,B> {};
+  template<template<typename,typename,typename> class Node, typename A, typename B, typename C>
+  struct NeboStencilReach< Node<A,B,C> > : NeboReachOfBoth< A, NeboReachOfBoth<B,C> > {};
+  template<template<typename,typename,typename,typename> class Node, typename A, typename B, typename C, typename D>
+  struct NeboStencilReach< Node<A,B,C,D> > : NeboReachOfBoth< NeboReachOfBoth<A,B>, NeboReachOfBoth<C,D> > {};
+  template<template<typename,typename,typename,typename,typename> class Node, typename A, typename B, typename C, typename D, typename E>
+  struct NeboStencilReach< Node<A,B,C,D,E> > : NeboReachOfBoth< NeboReachOfBoth<A,B>, NeboReachOfBoth< C, NeboReachOfBoth<D,E> > > {};
+
+  /**
+   * @brief The number of rows (y) in a tile of a stencil assignment.
+   *
+   * An assignment over a window walks z planes of full x rows.  A stencil
+   * that reaches \c zReach planes away reuses each source row up to
+   * 2*zReach+1 planes later, and once a plane is larger than the cache that
+   * row has been evicted in between.  Splitting the window into tiles of
+   * this many rows, each walked through all of its planes, keeps the
+   * 2*zReach+1 planes of the tile (plus \c yReach rows of halo either side)
+   * within NEBO_TILE_BYTES.  Rows stay whole so that the innermost loop is
+   * unit-stride.
+   *
+   * @return \c yExtent (a single tile) if tiling would not help
+   */
+  inline int nebo_tile_rows( const int xExtent,
+                             const int yExtent,
+                             const int yReach,
+                             const int zReach,
+                             const size_t elementSize )
+  {
+    // without reach in z, rows are reused while they are still in cache
+    if( zReach == 0 || NEBO_TILE_BYTES == 0 ) return yExtent;
+    const size_t bytesPerRow = size_t(xExtent) * elementSize * (2*zReach+1);
+    const int rows = int( size_t(NEBO_TILE_BYTES) / bytesPerRow ) - 2*yReach;
+    if( rows >= yExtent ) return yExtent;
+    // below this the halo rows cost more than the tiling saves
+    return rows > 2*yReach+1 ? rows : 2*yReach+1;
+  }
+
+  /**
+   * @brief The tile height for assigning the Nebo expression \c RhsType to a
+   *  field of \c ValueType whose window is \c xExtent by \c yExtent points.
+   */
+  template<typename RhsType, typename ValueType>
+  inline int nebo_tile_rows( const int xExtent, const int yExtent )
+  {
+    return nebo_tile_rows( xExtent, yExtent,
+                           NeboStencilReach<RhsType>::y,
+                           NeboStencilReach<RhsType>::z,
+                           sizeof(ValueType) );
+  }
+
+} // namespace SpatialOps
+
+#endif // Nebo_Tiling_h
@@ -25,11 +25,12 @@
 
 #include <spatialops/SpatialOpsConfigure.h>
 
-#include <boost/any.hpp>
+#include <boost/atomic.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <map>
-#include <list>
+#include <vector>
+#include <typeinfo>
 #include <stdexcept>
 #include <sstream>
 
@@ -44,7 +45,13 @@ namespace SpatialOps{
 class OperatorDatabase
 {
 
-  template<typename OpT> class OpStore
+  class OpStoreBase
+  {
+  public:
+    virtual ~OpStoreBase(){}
+  }; // class OpStoreBase
+
+  template<typename OpT> class OpStore : public OpStoreBase
   {
     typedef std::map<int,OpT*> IDOpMap;
     IDOpMap opMap_;
@@ -56,11 +63,22 @@ class OperatorDatabase
     OpT* get( const int id=-1 ) const;
   }; // class OpStore
 
-  typedef std::list< boost::any > StoreList;
+  /*
+   * Each operator type has a slot, the same in every database, given out the
+   * first time the type is registered or retrieved.  The store for a type is
+   * storeList_[slot], so finding it takes neither a search nor a comparison
+   * of type_info.
+   */
+  typedef std::vector< boost::shared_ptr<OpStoreBase> > StoreList;
   StoreList storeList_;
 
+  static inline size_t next_slot();
+
   template<typename OpT>
-  OpStore<OpT>* find() const;
+  static inline size_t slot();
+
+  template<typename OpT>
+  inline OpStore<OpT>* find() const;
 
 public:
 
@@ -124,17 +142,32 @@ public:
 //====================================================================
 
 
+size_t
+OperatorDatabase::next_slot()
+{
+  static boost::atomic<size_t> nslots(0);
+  return nslots++;
+}
+
+//--------------------------------------------------------------------
+
+template<typename OpT>
+size_t
+OperatorDatabase::slot()
+{
+  static const size_t theSlot = next_slot();
+  return theSlot;
+}
+
+//--------------------------------------------------------------------
+
 template<typename OpT>
 typename OperatorDatabase::OpStore<OpT>*
 OperatorDatabase::find() const
 {
-  typedef typename boost::shared_ptr< OpStore<OpT> > PtrT;
-  for( typename StoreList::const_iterator istor=storeList_.begin(); istor!=storeList_.end(); ++istor ){
-    if( typeid(PtrT) == istor->type() ){
-      return boost::any_cast<PtrT>(*istor).get();
-    }
-  }
-  return NULL;
+  const size_t i = slot<OpT>();
+  if( i >= storeList_.size() ) return NULL;
+  return static_cast<OpStore<OpT>*>( storeList_[i].get() );
 }
 
 //--------------------------------------------------------------------
@@ -146,9 +179,10 @@ OperatorDatabase::register_new_operator( OpT* const op )
   // see if we have a store built for this yet.
   OpStore<OpT>* store = this->find<OpT>();
   if( store==NULL ){
-    typedef boost::shared_ptr< OpStore<OpT> > PtrT;
     store = new OpStore<OpT>();
-    storeList_.push_back( PtrT(store) );
+    const size_t i = slot<OpT>();
+    if( i >= storeList_.size() ) storeList_.resize( i+1 );
+    storeList_[i].reset( store );
   }
   // add the operator
   return store->add(op);
@@ -1,4 +1,17 @@
 #include <spatialops/ThreadPool.h>
+#include <spatialops/CountdownLatch.h>
+
+#include <deque>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#ifdef __linux__
+# include <pthread.h>
+# include <sched.h>
+#endif
 
 namespace SpatialOps {
 
@@ -91,7 +104,7 @@ namespace SpatialOps {
 
      if( threads < 1 ) { threads = 1; }
      rit->second = threads;
-     resource->size_controller().resize(threads);
+     resource->resize(threads);
      return threads;
    }
 
@@ -108,7 +121,7 @@ namespace SpatialOps {
      }
      //Connect the right resource interface
      VoidType* resource = (VoidType*)rit->first;
-     resource->size_controller().resize_active(std::max(1,threads));
+     resource->resize_active(std::max(1,threads));
      return threads;
    }
 
@@ -145,8 +158,225 @@ namespace SpatialOps {
 
    //===========================================================================
 
+   struct WorkStealingPool::Worker{
+     struct Entry{
+       unsigned int priority;
+       Task task;
+     };
+     typedef std::deque<Entry> Queue;
+
+     boost::mutex mutex;     ///< guards queue
+     Queue queue;            ///< highest priority first, FIFO among equals
+     boost::thread* thread;
+     boost::atomic<bool> retire;  ///< set to stop this worker
+
+     Worker() : thread(NULL), retire(false) {}
+
+     void push( const Task& task, const unsigned int priority ){
+       Entry e;  e.priority = priority;  e.task = task;
+       boost::lock_guard<boost::mutex> lock( mutex );
+       if( queue.empty() || queue.back().priority >= priority ){
+         queue.push_back( e );
+       }
+       else{
+         Queue::iterator i = queue.end();
+         while( i != queue.begin() && (i-1)->priority < priority ) --i;
+         queue.insert( i, e );
+       }
+     }
+
+     /* take the head of the queue; thieves do not wait for a busy queue */
+     bool pop( Task& task, const bool steal ){
+       boost::unique_lock<boost::mutex> lock( mutex, boost::defer_lock );
+       if( steal ){ if( !lock.try_lock() ) return false; }
+       else       { lock.lock(); }
+       if( queue.empty() ) return false;
+       task = queue.front().task;
+       queue.pop_front();
+       return true;
+     }
+   };
+
+   struct WorkStealingPool::Shared{
+     Worker* workers[max_workers];
+     boost::atomic<int> nworkers;     ///< worker threads running
+     boost::atomic<int> nactive;      ///< workers that take on tasks
+     boost::atomic<int> highWater;    ///< workers[0,highWater) have been allocated
+     boost::atomic<long> pending;     ///< tasks queued
+     boost::atomic<long> running;     ///< tasks executing
+     boost::atomic<int> sleepers;     ///< workers parked on wakeup
+     boost::atomic<unsigned> next;    ///< round-robin cursor for schedule()
+
+     boost::mutex sleepMutex;
+     boost::condition_variable wakeup;   ///< new work, or a change in size
+     boost::condition_variable idle;     ///< parks workers beyond nactive
+     mutable boost::mutex doneMutex;
+     mutable boost::condition_variable done;  ///< pool drained
+     boost::mutex resizeMutex;
+
+     /* how long an idle worker spins before parking */
+     static const int spinLimit = 4000;
+
+     Shared() : nworkers(0), nactive(0), highWater(0), pending(0), running(0), sleepers(0), next(0) {}
+
+     bool find_task( const int me, Task& task ){
+       if( workers[me]->pop( task, false ) ) return true;
+       const int n = highWater;
+       for( int i=1; i<n; ++i ){
+         if( workers[(me+i)%n]->pop( task, true ) ) return true;
+       }
+       return false;
+     }
+
+     /* true if worker me may look for tasks */
+     bool may_work( const int me ){
+       return me < nactive && !workers[me]->retire;
+     }
+
+     void run( const int me ){
+       Worker& self = *workers[me];
+       while( true ){
+         if( !may_work(me) ){
+           boost::unique_lock<boost::mutex> lock( sleepMutex );
+           while( !self.retire && me >= nactive ) idle.wait( lock );
+           if( self.retire ) return;
+           continue;
+         }
+
+         Task task;
+         if( find_task( me, task ) ){
+           ++running;   // before the pending count drops, so wait() never sees neither
+           --pending;
+           task();
+           if( --running == 0 && pending == 0 ){
+             boost::lock_guard<boost::mutex> lock( doneMutex );
+             done.notify_all();
+           }
+           continue;
+         }
+
+         // queued work may be mid-push: spin a little before parking
+         for( int spin=0; spin<spinLimit && pending==0 && may_work(me); ++spin ) cpu_relax();
+         if( pending > 0 ) continue;
+
+         boost::unique_lock<boost::mutex> lock( sleepMutex );
+         ++sleepers;
+         while( pending == 0 && may_work(me) ) wakeup.wait( lock );
+         --sleepers;
+       }
+     }
+
+     void wake_all(){
+       boost::lock_guard<boost::mutex> lock( sleepMutex );
+       wakeup.notify_all();
+       idle.notify_all();
+     }
+   };
+
+   WorkStealingPool::WorkStealingPool( const int nthreads )
+     : shared_( new Shared() )
+   {
+     for( int i=0; i<max_workers; ++i ) shared_->workers[i] = NULL;
+     resize( nthreads );
+     resize_active( nthreads );
+   }
+
+   WorkStealingPool::~WorkStealingPool()
+   {
+     wait();
+     resize( 0 );
+     for( int i=0; i<shared_->highWater; ++i ) delete shared_->workers[i];
+     delete shared_;
+   }
+
+   bool WorkStealingPool::schedule( const Task& task, const unsigned int priority )
+   {
+     Shared& s = *shared_;
+     const int nactive = std::max( 1, std::min( int(s.nactive), int(s.highWater) ) );
+     ++s.pending;
+     s.workers[ s.next++ % nactive ]->push( task, priority );
+     if( s.sleepers > 0 ){
+       boost::lock_guard<boost::mutex> lock( s.sleepMutex );
+       s.wakeup.notify_one();
+     }
+     return true;
+   }
+
+   size_t WorkStealingPool::size() const{ return shared_->nworkers; }
+
+   size_t WorkStealingPool::max_active() const{ return shared_->nactive; }
+
+   size_t WorkStealingPool::active() const{ return shared_->running; }
+
+   size_t WorkStealingPool::pending() const{ return shared_->pending; }
+
+   void WorkStealingPool::wait() const
+   {
+     const Shared& s = *shared_;
+     boost::unique_lock<boost::mutex> lock( s.doneMutex );
+     while( s.pending > 0 || s.running > 0 ) s.done.wait( lock );
+   }
+
+   bool WorkStealingPool::resize( int nthreads )
+   {
+     Shared& s = *shared_;
+     boost::lock_guard<boost::mutex> lock( s.resizeMutex );
+     if( nthreads < 0 ) nthreads = 0;
+     if( nthreads > max_workers ){
+       fprintf(stderr, "Warning: WorkStealingPool is limited to %d threads\n", max_workers);
+       nthreads = max_workers;
+     }
+
+     const int old = s.nworkers;
+     if( nthreads > old ){
+       for( int i=old; i<nthreads; ++i ){
+         if( s.workers[i] == NULL ){
+           s.workers[i] = new Worker();
+           s.highWater = i+1;
+         }
+         s.workers[i]->retire = false;
+       }
+       s.nworkers = nthreads;
+       for( int i=old; i<nthreads; ++i ){
+         s.workers[i]->thread = new boost::thread( boost::bind( &Shared::run, &s, i ) );
+       }
+     }
+     else if( nthreads < old ){
+       {
+         boost::lock_guard<boost::mutex> sl( s.sleepMutex );
+         for( int i=nthreads; i<old; ++i ) s.workers[i]->retire = true;
+         s.nworkers = nthreads;
+         s.nactive  = std::min( int(s.nactive), nthreads );
+         s.wakeup.notify_all();
+         s.idle.notify_all();
+       }
+       for( int i=nthreads; i<old; ++i ){
+         s.workers[i]->thread->join();
+         delete s.workers[i]->thread;
+         s.workers[i]->thread = NULL;
+       }
+       // tasks left on the retired queues are stolen by the remaining workers
+       if( s.pending > 0 ) s.wake_all();
+     }
+     return true;
+   }
+
+   bool WorkStealingPool::resize_active( const int nthreads )
+   {
+     Shared& s = *shared_;
+     {
+       boost::lock_guard<boost::mutex> lock( s.sleepMutex );
+       s.nactive = std::max( 1, std::min( nthreads, int(s.nworkers) ) );
+       s.wakeup.notify_all();
+       s.idle.notify_all();
+     }
+     return true;
+   }
+
+   //===========================================================================
+
    ThreadPool::ThreadPool( const int nthreads )
-     : boost::threadpool::prio_pool( nthreads )
+     : WorkStealingPool( nthreads )
    {
      init_ = false;
    }
@@ -173,7 +403,7 @@ namespace SpatialOps {
      static ThreadPool tp(NTHREADS);
      ThreadPoolResourceManager& tprm = ThreadPoolResourceManager::self();
      if( tp.init_ == false ){
-       tprm.insert<boost::threadpool::prio_pool>(tp, NTHREADS);
+       tprm.insert<WorkStealingPool>(tp, NTHREADS);
        tp.init_ = true;
      }
      return tp;
@@ -182,7 +412,7 @@ namespace SpatialOps {
    //===========================================================================
 
    ThreadPoolFIFO::ThreadPoolFIFO( const int nthreads )
-     : boost::threadpool::fifo_pool( nthreads )
+     : WorkStealingPool( nthreads )
    {
      init_ = false;
    }
@@ -196,7 +426,7 @@ namespace SpatialOps {
      static ThreadPoolFIFO tp( NTHREADS );
      ThreadPoolResourceManager& tprm = ThreadPoolResourceManager::self();
      if( tp.init_ == false ){
-       tprm.insert<boost::threadpool::fifo_pool>( tp, NTHREADS );
+       tprm.insert<WorkStealingPool>( tp, NTHREADS );
        tp.init_ = true;
      }
      return tp;
@@ -218,4 +448,99 @@ namespace SpatialOps {
 
    //===========================================================================
 
+#  ifdef NEBO_NUMA
+   /* pin the calling thread to the index-th core it is allowed to run on */
+   static void pin_to_core( const int index )
+   {
+#   ifdef __linux__
+     cpu_set_t allowed;
+     CPU_ZERO( &allowed );
+     if( sched_getaffinity( 0, sizeof(cpu_set_t), &allowed ) != 0 ) return;
+     const int ncores = CPU_COUNT( &allowed );
+     if( ncores == 0 ) return;
+     int n = index % ncores;
+     for( int cpu=0; cpu<CPU_SETSIZE; ++cpu ){
+       if( !CPU_ISSET( cpu, &allowed ) ) continue;
+       if( n-- > 0 ) continue;
+       cpu_set_t mine;
+       CPU_ZERO( &mine );
+       CPU_SET( cpu, &mine );
+       if( pthread_setaffinity_np( pthread_self(), sizeof(cpu_set_t), &mine ) != 0 ){
+         fprintf(stderr, "Warning: could not pin ThreadPoolAffine worker %d to core %d\n", index, cpu);
+       }
+       return;
+     }
+#   endif
+   }
+#  endif // NEBO_NUMA
+
+   struct ThreadPoolAffine::Worker{
+     boost::mutex mutex;
+     boost::condition_variable cond;
+     std::deque<Task> tasks;
+     bool done;
+     boost::thread thread;
+
+     Worker( const int index )
+       : done( false ),
+         thread( boost::bind( &Worker::run, this, index ) )
+     {}
+
+     void run( const int index ){
+#      ifdef NEBO_NUMA
+       pin_to_core( index );
+#      endif
+       while( true ){
+         Task task;
+         {
+           boost::unique_lock<boost::mutex> lock( mutex );
+           while( tasks.empty() && !done ) cond.wait( lock );
+           if( tasks.empty() ) return;
+           task = tasks.front();
+           tasks.pop_front();
+         }
+         task();
+       }
+     }
+   };
+
+   ThreadPoolAffine::ThreadPoolAffine( const int nthreads )
+   {
+     for( int i=0; i<std::max(1,nthreads); ++i ){
+       workers_.push_back( new Worker(i) );
+     }
+   }
+
+   ThreadPoolAffine::~ThreadPoolAffine()
+   {
+     for( std::vector<Worker*>::iterator iw=workers_.begin(); iw!=workers_.end(); ++iw ){
+       {
+         boost::lock_guard<boost::mutex> lock( (*iw)->mutex );
+         (*iw)->done = true;
+       }
+       (*iw)->cond.notify_one();
+       (*iw)->thread.join();
+       delete *iw;
+     }
+   }
+
+   ThreadPoolAffine&
+   ThreadPoolAffine::self()
+   {
+     static ThreadPoolAffine tp( NTHREADS );
+     return tp;
+   }
+
+   void ThreadPoolAffine::schedule( const int partition, const Task& task )
+   {
+     Worker& worker = *workers_[ worker_of(partition) ];
+     {
+       boost::lock_guard<boost::mutex> lock( worker.mutex );
+       worker.tasks.push_back( task );
+     }
+     worker.cond.notify_one();
+   }
+
+   //===========================================================================
+
 } // namespace SpatialOps
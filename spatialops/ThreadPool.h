@@ -25,10 +25,12 @@
 
 #include <stdio.h>
 #include <map>
+#include <vector>
 #include <spatialops/SpatialOpsConfigure.h>
 #include <spatialops/threadpool/threadpool.hpp>
 
 #include <boost/thread/mutex.hpp>
+#include <boost/function.hpp>
 #include <boost/interprocess/sync/scoped_lock.hpp>
 
 #ifdef  FIELD_EXPRESSION_THREADS
@@ -53,10 +55,95 @@
 
 namespace SpatialOps{
 
+  /**
+   * \brief A work-stealing pool of worker threads.
+   *
+   * Every worker owns a queue, ordered by task priority and then by
+   * arrival, and guarded by its own lock.  Tasks are dealt round-robin to
+   * the active workers' queues; a worker that runs out of work steals the
+   * head of another worker's queue.  Idle workers spin briefly before
+   * parking, so a burst of small tasks (e.g. many Nebo partitions) is picked
+   * up without a trip through the kernel.
+   *
+   * Priorities order the tasks within one worker's queue.  Unlike the
+   * central queue of boost::threadpool::prio_pool, they do not order tasks
+   * across workers.
+   */
+  class WorkStealingPool
+  {
+  public:
+    typedef boost::function0<void> Task;
+
+    /** \brief the largest number of worker threads a pool may have */
+    static const int max_workers = 256;
+
+    /**
+     * @brief schedule a task for execution on some worker.
+     * @param task the work to do.  It should not throw exceptions.
+     * @param priority tasks with a higher priority run first
+     * @return true
+     */
+    bool schedule( const Task& task, const unsigned int priority=0 );
+
+    /**
+     * @return the number of worker threads in the pool
+     */
+    size_t size() const;
+
+    /**
+     * @return the maximum number of workers that take on tasks simultaneously
+     */
+    size_t max_active() const;
+
+    /**
+     * @brief change the number of worker threads in the pool.
+     *  Tasks queued on workers that are removed are taken over by the others.
+     */
+    bool resize( const int nthreads );
+
+    /**
+     * @brief change the number of workers that take on tasks.  The others
+     *  sleep until the pool is resized again.
+     */
+    bool resize_active( const int nthreads );
+
+    /**
+     * @return the number of tasks being executed
+     */
+    size_t active() const;
+
+    /**
+     * @return the number of tasks waiting to be executed
+     */
+    size_t pending() const;
+
+    /**
+     * @return true if no tasks are waiting to be executed
+     */
+    bool empty() const{ return pending() == 0; }
+
+    /**
+     * @brief block until all scheduled tasks have been executed
+     */
+    void wait() const;
+
+  protected:
+    WorkStealingPool( const int nthreads );
+    ~WorkStealingPool();
+
+  private:
+    struct Worker;
+    struct Shared;
+    Shared* shared_;
+
+    WorkStealingPool( const WorkStealingPool& );
+    WorkStealingPool& operator=( const WorkStealingPool& );
+  };
+
   /**
    * \brief Wrapper for a priority thread pool
    */
-  class ThreadPool : public boost::threadpool::prio_pool
+  class ThreadPool : public WorkStealingPool
   {
     /* constructor is private because this is implemented as a singleton. */
     ThreadPool( const int nthreads );
@@ -66,6 +153,15 @@ namespace SpatialOps{
     /** \brief obtain the singleton instance of ThreadPool */
     static ThreadPool& self();
 
+    using WorkStealingPool::schedule;
+
+    /**
+     * @brief schedule a task, honoring its priority
+     */
+    bool schedule( const boost::threadpool::prio_task_func& task ){
+      return WorkStealingPool::schedule( task, task.priority() );
+    }
+
     /**
      * @brief set the number of active worker threads in the pool.
      * @param threadCount the number of active threads in the pool
@@ -97,7 +193,7 @@ namespace SpatialOps{
   /**
    * \brief Wrapper for a FIFO thread pool
    */
-  class ThreadPoolFIFO : public boost::threadpool::fifo_pool{
+  class ThreadPoolFIFO : public WorkStealingPool{
     ThreadPoolFIFO( const int nthreads );
     ~ThreadPoolFIFO();
 
@@ -135,6 +231,53 @@ namespace SpatialOps{
   private:
     bool init_;
   };
+
+  /**
+   * \brief A pool of NTHREADS workers, each fed from its own queue.
+   *
+   * Tasks are scheduled by partition index rather than handed to whichever
+   * worker is free, and partition \c p always runs on worker
+   * <tt>p % size()</tt>, in the order it was scheduled.  Nebo's NUMA mode
+   * (NEBO_NUMA) uses this both to first-touch new field memory and to
+   * assign to fields, so each partition of a field is computed on the core,
+   * and hence the NUMA node, that holds its pages.  A NeboParallelRegion
+   * uses it to queue successive assignments without waiting in between.
+   *
+   * In NUMA mode, worker \c i is pinned to the i-th core that the process may run on
+   * (modulo the number of such cores), so an external binding such as
+   * \c taskset or an MPI launcher's is respected.  Pinning is only
+   * implemented on Linux; elsewhere the workers are left unpinned.
+   */
+  class ThreadPoolAffine{
+    ThreadPoolAffine( const int nthreads );
+    ~ThreadPoolAffine();
+
+    struct Worker;
+    std::vector<Worker*> workers_;
+
+  public:
+    typedef boost::function<void()> Task;
+
+    /** \brief obtain the singleton instance of ThreadPoolAffine */
+    static ThreadPoolAffine& self();
+
+    /**
+     * @brief run a task on the worker that owns the given partition
+     * @param partition the (0-based) partition index
+     * @param task the work to do
+     */
+    void schedule( const int partition, const Task& task );
+
+    /**
+     * @return the worker that runs tasks for the given partition
+     */
+    int worker_of( const int partition ) const{ return partition % size(); }
+
+    /**
+     * @return the number of workers in the pool
+     */
+    int size() const{ return workers_.size(); }
+  };
 } // namespace SpatialOps
 
 #endif // Field_Expr_ThreadPool_h
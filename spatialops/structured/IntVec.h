@@ -70,6 +70,12 @@ namespace structured{
                     (first[2] < second[2] ? first[2] : second[2]));
   }
 
+  inline IntVec max(const IntVec& first, const IntVec& second) {
+      return IntVec((first[0] > second[0] ? first[0] : second[0]),
+                    (first[1] > second[1] ? first[1] : second[1]),
+                    (first[2] > second[2] ? first[2] : second[2]));
+  }
+
 } // namespace structured
 } // namespace SpatialOps
 
@@ -35,16 +35,70 @@
 
 #include <boost/type_traits.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
 namespace SpatialOps{
 namespace structured{
 
+/*
+ * Each LOCAL_RAM block is preceded by a header of Pool<T>::alignment bytes
+ * holding its size, so that put() can find the size class of a block
+ * without consulting a table shared between threads.
+ */
+template< typename T >
+static inline T* block_data( void* const base, const size_t n )
+{
+  *static_cast<size_t*>(base) = n;
+  return reinterpret_cast<T*>( static_cast<char*>(base) + Pool<T>::alignment );
+}
+
+template< typename T >
+static inline void* block_base( T* const t )
+{
+  return reinterpret_cast<char*>(t) - Pool<T>::alignment;
+}
+
+template< typename T >
+static inline size_t block_size( T* const t )
+{
+  return *static_cast<size_t*>( block_base(t) );
+}
+
+/* allocate n values starting on a Pool<T>::alignment byte boundary */
+template< typename T >
+static T* aligned_new( const size_t n )
+{
+  void* p = NULL;
+  if( posix_memalign( &p, Pool<T>::alignment, Pool<T>::alignment + n*sizeof(T) ) != 0 ) throw std::bad_alloc();
+  return block_data<T>( p, n );
+}
+
+//------------------------------------------------------------------
+
+template< typename T >
+Pool<T>::ThreadCache::~ThreadCache()
+{
+  // if the pool has already been destroyed there is nowhere to return the
+  // blocks to; they leak on shut-down, as in Pool::put().
+  if( !destroyed_ ) Pool<T>::self().retire( *this );
+}
+
+//------------------------------------------------------------------
 
 template< typename T >
 Pool<T>::Pool() : deviceIndex_(0)
 {
   destroyed_ = false;
+  padRows_ = false;
   pad_ = 0;
   cpuhighWater_ = 0;
+  retiredHits_ = 0;
+  retiredMisses_ = 0;
+# ifndef ENABLE_THREADS
+  caches_.push_back( &cache_ );
+# endif
 # ifdef ENABLE_CUDA
   pinned_ = true;
   gpuhighWater_ = 0;
@@ -54,26 +108,19 @@ Pool<T>::Pool() : deviceIndex_(0)
 template< typename T >
 Pool<T>::~Pool()
 {
+  // return this thread's cached blocks to the depot so that they are freed below
+# ifdef ENABLE_THREADS
+  delete cache_.release();
+# else
+  retire( cache_ );
+# endif
+
   destroyed_ = true;
 
   for( typename FQSizeMap::iterator i=cpufqm_.begin(); i!=cpufqm_.end(); ++i ){
     FieldQueue& fq = i->second;
     while( !fq.empty() ){
-# ifdef ENABLE_CUDA
-      cudaError_t err;
-      if (pinned_) {
-        if (cudaSuccess != (err = cudaFreeHost(fq.top())) ) {
-          std::ostringstream msg;
-          msg << "Failed while freeing pinned memory " << __FILE__ << " : " << __LINE__
-            << std::endl;
-          msg << "\t - " << cudaGetErrorString(err);
-          throw(std::runtime_error(msg.str()));
-        }
-      }
-      else { delete [] fq.top(); }
-# else
-      delete [] fq.top();
-# endif
+      release( fq.top() );
       fq.pop();
     }
   }
@@ -110,12 +157,104 @@ Pool<T>::self()
   return p;
 }
 
+//------------------------------------------------------------------
+
+template< typename T >
+typename Pool<T>::ThreadCache&
+Pool<T>::thread_cache()
+{
+# ifdef ENABLE_THREADS
+  ThreadCache* cache = cache_.get();
+  if( cache == NULL ){
+    cache = new ThreadCache();
+    cache_.reset( cache );
+    boost::mutex::scoped_lock lock( depotMutex_ );
+    caches_.push_back( cache );
+  }
+  return *cache;
+# else
+  return cache_;
+# endif
+}
+
+template< typename T >
+void
+Pool<T>::retire( ThreadCache& cache )
+{
+# ifdef ENABLE_THREADS
+  boost::mutex::scoped_lock lock( depotMutex_ );
+# endif
+  for( typename FQSizeMap::iterator i=cache.fqm.begin(); i!=cache.fqm.end(); ++i ){
+    FieldQueue& fq = i->second;
+    FieldQueue& depot = cpufqm_[i->first];
+    while( !fq.empty() ){
+      depot.push( fq.top() );
+      fq.pop();
+    }
+  }
+  cache.fqm.clear();
+  cache.nblocks = 0;
+  retiredHits_   += cache.hits;
+  retiredMisses_ += cache.misses;
+  cache.hits = cache.misses = 0;
+  caches_.erase( std::remove( caches_.begin(), caches_.end(), &cache ), caches_.end() );
+}
+
+template< typename T >
+void
+Pool<T>::release( T* t )
+{
+# ifdef ENABLE_CUDA
+  cudaError_t err;
+  if (pinned_) {
+    if (cudaSuccess != (err = cudaFreeHost(block_base(t))) ) {
+      std::ostringstream msg;
+      msg << "Failed while freeing pinned memory " << __FILE__ << " : " << __LINE__
+        << std::endl;
+      msg << "\t - " << cudaGetErrorString(err);
+      throw(std::runtime_error(msg.str()));
+    }
+  }
+  else { free( block_base(t) ); }
+# else
+  free( block_base(t) );
+# endif
+}
+
+//------------------------------------------------------------------
+
 template< typename T >
 T*
-Pool<T>::get( const MemoryType mtype, const size_t _n )
+Pool<T>::get( const MemoryType mtype, const size_t n, bool* const fresh )
 {
   assert( !destroyed_ );
+  if( fresh ) *fresh = false;
+
+  if( mtype == LOCAL_RAM ){
+    // any cached block that is large enough will do
+    ThreadCache& cache = thread_cache();
+    const typename FQSizeMap::iterator ifq = cache.fqm.lower_bound( n );
+    if( ifq != cache.fqm.end() ){
+      T* const field = ifq->second.top();
+      ifq->second.pop();
+      if( ifq->second.empty() ) cache.fqm.erase( ifq );
+      --cache.nblocks;
+      ++cache.hits;
+      return field;
+    }
+    ++cache.misses;
+  }
+
+# ifdef ENABLE_THREADS
+  boost::mutex::scoped_lock lock( depotMutex_ );
+# endif
+  return depot_get( mtype, n, fresh );
+}
 
+template< typename T >
+T*
+Pool<T>::depot_get( const MemoryType mtype, const size_t _n, bool* const fresh )
+{
   if( pad_==0 ) pad_ = _n/10;
   size_t n = _n+pad_;
 
@@ -132,6 +271,7 @@ Pool<T>::get( const MemoryType mtype, const size_t _n )
     FieldQueue& fq = ifq->second;
     if( fq.empty() ){
       ++cpuhighWater_;
+      if( fresh ) *fresh = true;
       try{
 #ifdef ENABLE_CUDA
         /* Pinned Memory Mode
@@ -140,18 +280,22 @@ Pool<T>::get( const MemoryType mtype, const size_t _n )
          * and destroyed only once.
          */
         cudaError_t err;
-        if (cudaSuccess != (err = cudaMallocHost((void**)&field, n*sizeof(T)))) {
+        void* base = NULL;
+        if (cudaSuccess != (err = cudaMallocHost(&base, alignment + n*sizeof(T)))) {
           std::ostringstream msg;
           msg << "WARNING : Pinned Memory allocation failed , at " << __FILE__ << " : " << __LINE__
               << std::endl;
           msg << "\t - " << cudaGetErrorString(err);
           msg << "Allocating Pageable memory instead. \n";
-          field = new T[n];
+          field = aligned_new<T>(n);
           pinned_ = false;
         }
+        else{
+          field = block_data<T>( base, n );
+        }
 #else
         // Pageable Memory mode
-        field = new T[n];
+        field = aligned_new<T>(n);
 #endif
       }
       catch(std::runtime_error& e){
@@ -159,7 +303,6 @@ Pool<T>::get( const MemoryType mtype, const size_t _n )
                   << e.what() << std::endl
                   << __FILE__ << " : " << __LINE__ << std::endl;
       }
-      fsm_[field] = n;
     }
     else{
       field = fq.top(); fq.pop();
@@ -179,6 +322,7 @@ Pool<T>::get( const MemoryType mtype, const size_t _n )
     FieldQueue& fq = ifq->second;
     if( fq.empty() ) {
       ++gpuhighWater_;
+      if( fresh ) *fresh = true;
       ema::cuda::CUDADeviceInterface& CDI = ema::cuda::CUDADeviceInterface::self();
       field = (T*)CDI.get_raw_pointer( n * sizeof(T), deviceIndex_ );
       fsm_[field] = n;
@@ -200,6 +344,8 @@ Pool<T>::get( const MemoryType mtype, const size_t _n )
   } //switch
 }
 
+//------------------------------------------------------------------
+
 template< typename T >
 void
 Pool<T>::put( const MemoryType mtype, T* t )
@@ -211,9 +357,28 @@ Pool<T>::put( const MemoryType mtype, T* t )
   // leak memory on shut-down in those cases.
   if( destroyed_ ) return;
 
+  if( mtype == LOCAL_RAM ){
+    ThreadCache& cache = thread_cache();
+    if( cache.nblocks < cacheDepth ){
+      cache.fqm[ block_size(t) ].push(t);
+      ++cache.nblocks;
+      return;
+    }
+  }
+
+# ifdef ENABLE_THREADS
+  boost::mutex::scoped_lock lock( depotMutex_ );
+# endif
+  depot_put( mtype, t );
+}
+
+template< typename T >
+void
+Pool<T>::depot_put( const MemoryType mtype, T* t )
+{
   switch(mtype) {
   case LOCAL_RAM: {
-    const size_t n = fsm_[t];
+    const size_t n = block_size(t);
     const typename FQSizeMap::iterator ifq = cpufqm_.lower_bound( n );
     assert( ifq != cpufqm_.end() );
     ifq->second.push(t);
@@ -239,16 +404,50 @@ Pool<T>::put( const MemoryType mtype, T* t )
   }//switch
 }
 
+//------------------------------------------------------------------
+
 template<typename T>
 size_t
 Pool<T>::active() const{
+# ifdef ENABLE_THREADS
+  boost::mutex::scoped_lock lock( depotMutex_ );
+# endif
   size_t n=0;
   for( typename FQSizeMap::const_iterator ifq=cpufqm_.begin(); ifq!=cpufqm_.end(); ++ifq ){
     n += ifq->second.size();
   }
+  for( typename std::vector<ThreadCache*>::const_iterator ic=caches_.begin(); ic!=caches_.end(); ++ic ){
+    n += (*ic)->nblocks;
+  }
   return cpuhighWater_-n;
 }
 
+template<typename T>
+size_t
+Pool<T>::cache_hits() const{
+# ifdef ENABLE_THREADS
+  boost::mutex::scoped_lock lock( depotMutex_ );
+# endif
+  size_t n = retiredHits_;
+  for( typename std::vector<ThreadCache*>::const_iterator ic=caches_.begin(); ic!=caches_.end(); ++ic ){
+    n += (*ic)->hits;
+  }
+  return n;
+}
+
+template<typename T>
+size_t
+Pool<T>::cache_misses() const{
+# ifdef ENABLE_THREADS
+  boost::mutex::scoped_lock lock( depotMutex_ );
+# endif
+  size_t n = retiredMisses_;
+  for( typename std::vector<ThreadCache*>::const_iterator ic=caches_.begin(); ic!=caches_.end(); ++ic ){
+    n += (*ic)->misses;
+  }
+  return n;
+}
+
 
 // explicit instantiation
 template class Pool<double>;
@@ -25,37 +25,127 @@
 
 #include <stack>
 #include <map>
+#include <vector>
 
+#include <spatialops/SpatialOpsConfigure.h>
 #include <spatialops/structured/MemoryTypes.h>
 
+#ifdef ENABLE_THREADS
+# include <boost/thread/mutex.hpp>
+# include <boost/thread/tss.hpp>
+#endif
+
 namespace SpatialOps {
 namespace structured {
 
+/**
+ *  \class Pool
+ *  \brief Recycles field memory, keyed by the size of the allocation.
+ *
+ *  All LOCAL_RAM blocks handed out by the pool start on an \c alignment
+ *  byte boundary.  When row padding is enabled (see set_row_padding()),
+ *  SpatialFieldStore additionally rounds the x-dimension row pitch of the
+ *  fields it builds up to row_multiple() points, so that every row of such
+ *  a field starts on the same boundary.
+ *
+ *  The pool may be used from several threads at once.  Each thread keeps a
+ *  small cache of the LOCAL_RAM blocks it has returned, and reuses them
+ *  without locking.  Only cache misses, overflowing caches and GPU blocks go
+ *  through the shared depot, which is guarded by a mutex when
+ *  ENABLE_THREADS is on.
+ */
 template<typename T>
 class Pool{
   typedef std::stack<T*> FieldQueue;
   typedef std::map<size_t,FieldQueue> FQSizeMap;
   typedef std::map<T*,size_t> FieldSizeMap;
 
+  /**
+   *  \brief LOCAL_RAM blocks returned by one thread, kept for that thread's
+   *  next requests of the same size class.
+   */
+  struct ThreadCache{
+    FQSizeMap fqm;
+    size_t nblocks;
+    size_t hits, misses;
+    ThreadCache() : nblocks(0), hits(0), misses(0) {}
+    ~ThreadCache();
+  };
+
   static bool destroyed_;
   bool pinned_;
+  bool padRows_;
 
   FQSizeMap cpufqm_, gpufqm_;
   FieldSizeMap fsm_;
   size_t pad_;
   size_t cpuhighWater_, gpuhighWater_;
+  size_t retiredHits_, retiredMisses_;
+  std::vector<ThreadCache*> caches_;
+
+# ifdef ENABLE_THREADS
+  mutable boost::mutex depotMutex_;
+  boost::thread_specific_ptr<ThreadCache> cache_;
+# else
+  ThreadCache cache_;
+# endif
+
   Pool();
   ~Pool();
   Pool(const Pool&);
   Pool& operator=(const Pool&);
 
+  ThreadCache& thread_cache();
+  T* depot_get( const MemoryType mtype, size_t n, bool* const fresh );
+  void depot_put( const MemoryType mtype, T* );
+  void retire( ThreadCache& );
+  void release( T* );
+
  public:
 
+  /** \brief alignment (in bytes) of every LOCAL_RAM block: one cache line, and wide enough for AVX-512 */
+  static const size_t alignment = 64;
+
+  /** \brief the most LOCAL_RAM blocks that a thread keeps in its own cache */
+  static const size_t cacheDepth = 16;
+
   static Pool& self();
-  T* get( const MemoryType mtype, const size_t n );
+
+  /**
+   * \brief obtain a block of at least \c n values.
+   * \param fresh if given, set to true when the block was newly allocated,
+   *  i.e. its pages have not been touched yet, and to false when it is reused.
+   */
+  T* get( const MemoryType mtype, const size_t n, bool* const fresh=NULL );
   void put( const MemoryType mtype, T* );
   size_t active() const;
   size_t total() const{ return cpuhighWater_; }
+
+  /**
+   * \brief number of LOCAL_RAM requests served from the requesting thread's
+   *  own cache.  Exact once the other threads are idle.
+   */
+  size_t cache_hits() const;
+
+  /**
+   * \brief number of LOCAL_RAM requests that went to the shared depot, either
+   *  reusing a block there or allocating a new one (see total()).
+   */
+  size_t cache_misses() const;
+
+  /**
+   * \brief Turn padding of the x-dimension row pitch on or off for fields
+   *  subsequently obtained from the SpatialFieldStore.  Off by default.
+   */
+  void set_row_padding( const bool pad ){ padRows_ = pad; }
+  bool row_padding() const{ return padRows_; }
+
+  /**
+   * \brief the number of points that the row pitch of fields from the
+   *  SpatialFieldStore is rounded up to (1 when row padding is off).
+   */
+  size_t row_multiple() const{ return padRows_ ? alignment/sizeof(T) : 1; }
+
   const unsigned short int deviceIndex_;
 };
 
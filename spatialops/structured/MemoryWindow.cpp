@@ -131,6 +131,19 @@ namespace SpatialOps{
 
     //---------------------------------------------------------------
 
+    MemoryWindow
+    MemoryWindow::pad_row_pitch( const int multiple ) const
+    {
+#     ifndef NDEBUG
+      assert( multiple > 0 );
+#     endif
+      if( nptsGlob_[0] == 1 || multiple == 1 ) return *this;
+      const int pitch = multiple * ( (nptsGlob_[0] + multiple - 1) / multiple );
+      return MemoryWindow( IntVec( pitch, nptsGlob_[1], nptsGlob_[2] ), offset_, extent_ );
+    }
+
+    //---------------------------------------------------------------
+
     ostream& operator<<(ostream& os, const MemoryWindow& w ){
       os << w.nptsGlob_ << w.offset_ << w.extent_;
       return os;
@@ -131,6 +131,22 @@ namespace structured{
     refine( const IntVec& splitPattern,
             const IntVec& location ) const;
 
+    /**
+     *  \brief Obtain a window over the same points whose x-dimension row
+     *         pitch, glob_dim(0), is rounded up to a multiple of the given
+     *         number of points.
+     *
+     *  \param multiple the number of points that the row pitch must be a
+     *         multiple of.  Typically the number of values in a vector
+     *         register or cache line.
+     *
+     *  The offset and extent are unchanged, so the padding at the end of
+     *  each row is never visited.  Windows that are one point wide in x are
+     *  returned as is.
+     */
+    MemoryWindow
+    pad_row_pitch( const int multiple ) const;
+
     /**
      *  \brief given the local ijk location (0-based on the local
      *         window), obtain the flat index in the global memory
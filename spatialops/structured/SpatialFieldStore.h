@@ -36,8 +36,13 @@
 
 #include <boost/type_traits.hpp>
 
-#ifdef ENABLE_THREADS
-# include <boost/thread/mutex.hpp>
+#ifdef NEBO_NUMA
+# include <spatialops/NeboBasic.h>
+#endif
+
+#ifdef FIELD_EXPRESSION_THREADS
+# include <spatialops/NeboParallelRegion.h>
+# include <boost/bind.hpp>
 #endif
 
 namespace SpatialOps {
@@ -196,11 +201,12 @@ private:
  *
  *  @par Thread-Parallelism Issues:
  *
- *  NOTE: this could get us into big trouble if we have threads
- *  running concurrently, since we would not be able to guarantee
- *  that two threads didn't use the same memory.
- *
- *  \todo Implement a thread-safe version of this concept.
+ *  Fields may be obtained and restored from several threads at once.
+ *  The underlying structured::Pool is thread-safe and serves most
+ *  requests from a per-thread cache, so the store takes no lock of
+ *  its own.  Fields restored inside a NeboParallelRegion go back to the
+ *  pool only when the region next synchronizes, since assignments
+ *  queued in the region may still be using them.
  */
 class SpatialFieldStore {
 
@@ -277,11 +283,19 @@ public:
 
 private:
 
-#ifdef ENABLE_THREADS
+#ifdef NEBO_NUMA
   /**
-   *  Used to lock threads to prevent simultaneous access.
+   *  @brief First-touch new field memory from the ThreadPoolAffine worker
+   *         that will later assign to each of its partitions, so that the
+   *         pages land on that worker's NUMA node.
    */
-  inline static boost::mutex& get_mutex() {static boost::mutex m; return m;}
+  template<typename ValT>
+  static void first_touch( const structured::MemoryWindow& window, ValT* const values );
+
+  template<typename ValT>
+  static void touch_partition( const structured::MemoryWindow& window,
+                               ValT* const values,
+                               CountdownLatch* const latch );
 #endif
 
 };
@@ -449,12 +463,10 @@ get_from_window( const structured::MemoryWindow& window,
                  const unsigned short int deviceIndex )
 {
   typedef typename FieldT::value_type ValT;
-# ifdef ENABLE_THREADS
-  boost::mutex::scoped_lock lock( get_mutex() );
-# endif
-    const structured::MemoryWindow mw( window.extent(),
-                                       structured::IntVec(0,0,0),
-                                       window.extent() );
+    const structured::MemoryWindow mw = structured::MemoryWindow( window.extent(),
+                                                                  structured::IntVec(0,0,0),
+                                                                  window.extent() )
+      .pad_row_pitch( structured::Pool<ValT>::self().row_multiple() );
     const size_t npts = mw.glob_npts();
 
 #   ifndef NDEBUG
@@ -464,7 +476,13 @@ get_from_window( const structured::MemoryWindow& window,
 
   switch (mtype) {
   case LOCAL_RAM: { // Allocate from a store
+#   ifdef NEBO_NUMA
+    bool fresh = false;
+    ValT* fnew = structured::Pool<ValT>::self().get(mtype,npts,&fresh);
+    if( fresh ) first_touch( mw, fnew );
+#   else
     ValT* fnew = structured::Pool<ValT>::self().get(mtype,npts);
+#   endif
 #   ifndef NDEBUG  // only zero the field for debug runs.
     ValT* iftmp = fnew;
     for( size_t i=0; i<npts; ++i, ++iftmp )  *iftmp = 0.0;
@@ -497,14 +515,60 @@ template<typename FieldT>
 inline
 void SpatialFieldStore::restore_field( const MemoryType mtype, FieldT& field )
 {
-# ifdef ENABLE_THREADS
-  boost::mutex::scoped_lock lock( get_mutex() );
-# endif
   typedef typename FieldT::value_type ValT;
   ValT * values = const_cast<ValT *>((const_cast<FieldT const &>(field)).field_values(field.memory_device_type(), field.device_index()));
+# ifdef FIELD_EXPRESSION_THREADS
+  // assignments queued in a parallel region may still be using the memory
+  NeboParallelRegion* const region = NeboParallelRegion::current();
+  if( region ){
+    region->defer( boost::bind( &structured::Pool<ValT>::put, &structured::Pool<ValT>::self(), mtype, values ) );
+    return;
+  }
+# endif
   structured::Pool<ValT>::self().put( mtype, values );
 }
 
+//------------------------------------------------------------------
+
+#ifdef NEBO_NUMA
+
+template<typename ValT>
+void SpatialFieldStore::first_touch( const structured::MemoryWindow& window, ValT* const values )
+{
+  // new fields are partitioned NTHREADS ways (see SpatialField::get_partition_count)
+  const structured::IntVec split = nebo_find_partition( window.extent(), NTHREADS );
+  const int max = nebo_partition_count( split );
+
+  CountdownLatch latch(max);
+  structured::IntVec location(0,0,0);
+  for( int count=0; count<max; ++count ){
+    ThreadPoolAffine::self().schedule( count,
+                                       boost::bind( &SpatialFieldStore::touch_partition<ValT>,
+                                                    window.refine( split, location ),
+                                                    values,
+                                                    &latch ) );
+    location = nebo_next_partition( location, split );
+  }
+  latch.wait();
+}
+
+template<typename ValT>
+void SpatialFieldStore::touch_partition( const structured::MemoryWindow& window,
+                                         ValT* const values,
+                                         CountdownLatch* const latch )
+{
+  const structured::IntVec& extent = window.extent();
+  for( int k=0; k<extent[2]; ++k ){
+    for( int j=0; j<extent[1]; ++j ){
+      ValT* row = values + window.flat_index( structured::IntVec(0,j,k) );
+      for( int i=0; i<extent[0]; ++i ) row[i] = 0;
+    }
+  }
+  latch->count_down();
+}
+
+#endif // NEBO_NUMA
+
 } // namespace SpatialOps
 
 #endif
@@ -270,7 +270,171 @@ namespace structured{
   FD_ALL_VOL_FIELDS( GradientY )
   FD_ALL_VOL_FIELDS( GradientZ )
 
+
+  /**
+   *  \struct ConstCoefOperatorTypeBuilder
+   *
+   *  \brief Builds interpolant types whose coefficients are compile-time constants
+   *  \tparam OpT the type of interpolant (\c Interpolant, \c InterpolantX, \c InterpolantY, \c InterpolantZ)
+   *  \tparam SrcT the field type that the operator acts on
+   *  \tparam DestT the field type that the operator produces
+   *
+   *  An interpolant averages its points, so \c type has the points of
+   *  <tt>OperatorTypeBuilder<OpT,SrcT,DestT>::type</tt>, each with the
+   *  coefficient 1/(number of points), built in (see NeboStencilConstCoefs.h).
+   *  These operators are default constructed, so they need not be
+   *  retrieved from an OperatorDatabase.
+   *
+   *  \par Example Usage
+   *  \code
+   *  typedef ConstCoefOperatorTypeBuilder<Interpolant,SVolField,SSurfXField>::type InterpC2FX;
+   *  const InterpC2FX interp;
+   *  dest <<= interp( src );
+   *  \endcode
+   */
+  template<typename OpT, typename SrcT, typename DestT>
+  struct ConstCoefOperatorTypeBuilder;
+
+  template<typename OpT, typename SrcT, typename DestT>
+  struct ConstCoefInterpolantTypeBuilder{
+    typedef typename OperatorTypeBuilder<OpT,SrcT,DestT>::type::PointCollectionType Points;
+    typedef NeboConstCoefStencilBuilder<OpT,
+                                        typename NeboStencilUniformCoefPoints<Points,
+                                                                              NeboStencilConstCoef<1,Points::length> >::Result,
+                                        SrcT,
+                                        DestT>
+            type;
+  };
+
+#define CONST_COEF_OP_BUILDER( OP )                          \
+  template<typename SrcT, typename DestT>                    \
+  struct ConstCoefOperatorTypeBuilder<OP,SrcT,DestT>         \
+    : public ConstCoefInterpolantTypeBuilder<OP,SrcT,DestT>  \
+  {};
+
+  CONST_COEF_OP_BUILDER( Interpolant  )
+  CONST_COEF_OP_BUILDER( InterpolantX )
+  CONST_COEF_OP_BUILDER( InterpolantY )
+  CONST_COEF_OP_BUILDER( InterpolantZ )
+
+  //-----------------------------------------------------------------------
+  //---- The operators that build_stencils registers are compiled once, ---
+  //---- into the spatialops-stencil library (StencilInstantiations.cpp). --
+  //---- Files that apply them skip compiling them again: see           ----
+  //---- ENABLE_EXTERN_OPERATORS in the top level CMakeLists.txt.       ----
+  //-----------------------------------------------------------------------
+
+#define SO_BASIC_OPERATORS( VOL, OPERATOR )                                   \
+  OPERATOR( Interpolant, VOL, structured::FaceTypes<VOL>::XFace )             \
+  OPERATOR( Interpolant, VOL, structured::FaceTypes<VOL>::YFace )             \
+  OPERATOR( Interpolant, VOL, structured::FaceTypes<VOL>::ZFace )             \
+  OPERATOR( Interpolant, structured::FaceTypes<VOL>::XFace, VOL )             \
+  OPERATOR( Interpolant, structured::FaceTypes<VOL>::YFace, VOL )             \
+  OPERATOR( Interpolant, structured::FaceTypes<VOL>::ZFace, VOL )             \
+  OPERATOR( Gradient,    VOL, structured::FaceTypes<VOL>::XFace )             \
+  OPERATOR( Gradient,    VOL, structured::FaceTypes<VOL>::YFace )             \
+  OPERATOR( Gradient,    VOL, structured::FaceTypes<VOL>::ZFace )             \
+  OPERATOR( Divergence,  structured::FaceTypes<VOL>::XFace, VOL )             \
+  OPERATOR( Divergence,  structured::FaceTypes<VOL>::YFace, VOL )             \
+  OPERATOR( Divergence,  structured::FaceTypes<VOL>::ZFace, VOL )
+
+#define SO_FD_OPERATORS( VOL, OPERATOR )                                      \
+  OPERATOR( InterpolantX, VOL, VOL )                                          \
+  OPERATOR( InterpolantY, VOL, VOL )                                          \
+  OPERATOR( InterpolantZ, VOL, VOL )                                          \
+  OPERATOR( GradientX,    VOL, VOL )                                          \
+  OPERATOR( GradientY,    VOL, VOL )                                          \
+  OPERATOR( GradientZ,    VOL, VOL )
+
+  /**
+   *  \brief Applies \c OPERATOR( OpT, SrcT, DestT ) to each operator that
+   *         build_stencils registers.  For use in namespace SpatialOps.
+   */
+#define SO_BUILD_STENCILS_OPERATORS( OPERATOR )                               \
+  /* stencil2 */                                                              \
+  SO_BASIC_OPERATORS( structured::SVolField, OPERATOR )                       \
+  SO_BASIC_OPERATORS( structured::XVolField, OPERATOR )                       \
+  SO_BASIC_OPERATORS( structured::YVolField, OPERATOR )                       \
+  SO_BASIC_OPERATORS( structured::ZVolField, OPERATOR )                       \
+  OPERATOR( Interpolant, structured::XVolField, structured::YSurfXField )     \
+  OPERATOR( Gradient,    structured::XVolField, structured::YSurfXField )     \
+  OPERATOR( Interpolant, structured::XVolField, structured::ZSurfXField )     \
+  OPERATOR( Gradient,    structured::XVolField, structured::ZSurfXField )     \
+  OPERATOR( Interpolant, structured::YVolField, structured::XSurfYField )     \
+  OPERATOR( Gradient,    structured::YVolField, structured::XSurfYField )     \
+  OPERATOR( Interpolant, structured::YVolField, structured::ZSurfYField )     \
+  OPERATOR( Gradient,    structured::YVolField, structured::ZSurfYField )     \
+  OPERATOR( Interpolant, structured::ZVolField, structured::XSurfZField )     \
+  OPERATOR( Gradient,    structured::ZVolField, structured::XSurfZField )     \
+  OPERATOR( Interpolant, structured::ZVolField, structured::YSurfZField )     \
+  OPERATOR( Gradient,    structured::ZVolField, structured::YSurfZField )     \
+  OPERATOR( Interpolant, structured::SVolField, structured::XVolField   )     \
+  OPERATOR( Gradient,    structured::SVolField, structured::XVolField   )     \
+  OPERATOR( Interpolant, structured::SVolField, structured::YVolField   )     \
+  OPERATOR( Gradient,    structured::SVolField, structured::YVolField   )     \
+  OPERATOR( Interpolant, structured::SVolField, structured::ZVolField   )     \
+  OPERATOR( Gradient,    structured::SVolField, structured::ZVolField   )     \
+  OPERATOR( Interpolant, structured::XVolField, structured::SVolField   )     \
+  OPERATOR( Gradient,    structured::XVolField, structured::SVolField   )     \
+  OPERATOR( Interpolant, structured::YVolField, structured::SVolField   )     \
+  OPERATOR( Gradient,    structured::YVolField, structured::SVolField   )     \
+  OPERATOR( Interpolant, structured::ZVolField, structured::SVolField   )     \
+  OPERATOR( Gradient,    structured::ZVolField, structured::SVolField   )     \
+  /* null stencil */                                                          \
+  OPERATOR( Interpolant, structured::SVolField,   structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::XVolField,   structured::XVolField   )   \
+  OPERATOR( Interpolant, structured::YVolField,   structured::YVolField   )   \
+  OPERATOR( Interpolant, structured::ZVolField,   structured::ZVolField   )   \
+  OPERATOR( Interpolant, structured::XVolField,   structured::SSurfXField )   \
+  OPERATOR( Interpolant, structured::YVolField,   structured::SSurfYField )   \
+  OPERATOR( Interpolant, structured::ZVolField,   structured::SSurfZField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::XSurfXField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::YSurfYField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::ZSurfZField )   \
+  OPERATOR( Interpolant, structured::XSurfXField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::YSurfYField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::ZSurfZField, structured::SVolField   )   \
+  /* stencil4 */                                                              \
+  OPERATOR( Interpolant, structured::SVolField,   structured::XSurfYField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::XSurfZField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::YSurfXField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::YSurfZField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::ZSurfXField )   \
+  OPERATOR( Interpolant, structured::SVolField,   structured::ZSurfYField )   \
+  OPERATOR( Interpolant, structured::XSurfYField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::XSurfZField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::YSurfXField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::YSurfZField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::ZSurfXField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::ZSurfYField, structured::SVolField   )   \
+  OPERATOR( Interpolant, structured::XVolField,   structured::YVolField   )   \
+  OPERATOR( Interpolant, structured::XVolField,   structured::ZVolField   )   \
+  OPERATOR( Interpolant, structured::YVolField,   structured::XVolField   )   \
+  OPERATOR( Interpolant, structured::YVolField,   structured::ZVolField   )   \
+  OPERATOR( Interpolant, structured::ZVolField,   structured::XVolField   )   \
+  OPERATOR( Interpolant, structured::ZVolField,   structured::YVolField   )   \
+  /* box filter */                                                            \
+  OPERATOR( Filter, structured::SVolField, structured::SVolField )            \
+  OPERATOR( Filter, structured::XVolField, structured::XVolField )            \
+  OPERATOR( Filter, structured::YVolField, structured::YVolField )            \
+  OPERATOR( Filter, structured::ZVolField, structured::ZVolField )            \
+  /* finite difference */                                                     \
+  SO_FD_OPERATORS( structured::SVolField, OPERATOR )                          \
+  SO_FD_OPERATORS( structured::XVolField, OPERATOR )                          \
+  SO_FD_OPERATORS( structured::YVolField, OPERATOR )                          \
+  SO_FD_OPERATORS( structured::ZVolField, OPERATOR )
+
+#define SO_EXTERN_OPERATOR( OP, SRC, DEST )                                   \
+  extern template void                                                        \
+  structured::OperatorTypeBuilder<OP,SRC,DEST>::type::apply_to_field( const SrcFieldType&, DestFieldType& ) const;
+
 } // namespace structured
+
+  // explicit instantiations belong to the namespace of NeboStencilBuilder
+#if defined(NEBO_EXTERN_OPERATORS) && !defined(__CUDACC__)
+  SO_BUILD_STENCILS_OPERATORS( SO_EXTERN_OPERATOR )
+#endif
+
 } // namespace SpatialOps
 
 #endif // SpatialOps_structured_FVStaggeredOpTypes_h
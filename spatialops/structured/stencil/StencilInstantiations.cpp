@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2014 The University of Utah
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/*
+ * The operators that build_stencils registers, compiled once for every file
+ * that applies them (see SO_BUILD_STENCILS_OPERATORS).
+ */
+
+#include "FVStaggeredOperatorTypes.h"
+
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+
+namespace SpatialOps{
+
+#ifdef NEBO_EXTERN_OPERATORS
+
+#define SO_INSTANTIATE_OPERATOR( OP, SRC, DEST )                              \
+  template void                                                               \
+  structured::OperatorTypeBuilder<OP,SRC,DEST>::type::apply_to_field( const SrcFieldType&, DestFieldType& ) const;
+
+  SO_BUILD_STENCILS_OPERATORS( SO_INSTANTIATE_OPERATOR )
+
+#endif // NEBO_EXTERN_OPERATORS
+
+} // namespace SpatialOps
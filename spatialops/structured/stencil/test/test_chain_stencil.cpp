@@ -86,7 +86,9 @@ template<typename FirstOpType,
     /* run operator: */
     test <<= (*secondOp)((*firstOp)(src));
 
-    return interior_display_fields_compare(ref, test, false, false);
+    return interior_fields_close(ref,
+                                 test,
+                                 (NEBO_COLLAPSE_STENCILS ? 1e-13 : 0.0));
  }
 template<typename FirstOpType,
          typename SecondOpType,
@@ -0,0 +1,144 @@
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+#include <spatialops/Nebo.h>
+
+#include <test/TestHelper.h>
+#include <test/FieldHelper.h>
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+
+using namespace SpatialOps;
+using namespace structured;
+namespace po = boost::program_options;
+
+typedef BasicOpTypes<SVolField> OpTypes;
+typedef NeboSumStencilBuilder<BoxFilter1DXStencilCollection::StPtCollection, SVolField, SVolField> SumX;
+
+/* the number of points read by a collapsed stencil expression */
+template<typename Pts, typename Arg, typename FieldType>
+int points( const NeboExpression<NeboStencil<Initial, Pts, Arg, FieldType>, FieldType> & )
+{
+  return Pts::length;
+}
+
+/* the coefficient of point (x,y,z) of a collapsed stencil expression */
+template<int X, int Y, int Z, typename Pts, typename Arg, typename FieldType>
+double coef( const NeboExpression<NeboStencil<Initial, Pts, Arg, FieldType>, FieldType> & stencil )
+{
+  return stencil.expr().coefs().get_coef( NeboStencilPointIndex<IndexTriplet<X,Y,Z>, Pts>::value );
+}
+
+int main( int iarg, char* carg[] )
+{
+  int nx, ny, nz;
+  bool bc[] = { false, false, false };
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&nx)->default_value(11), "number of points in x-dir" )
+      ( "ny", po::value<int>(&ny)->default_value(11), "number of points in y-dir" )
+      ( "nz", po::value<int>(&nz)->default_value(11), "number of points in z-dir" )
+      ( "bcx", "physical boundary on +x side?" )
+      ( "bcy", "physical boundary on +y side?" )
+      ( "bcz", "physical boundary on +z side?" );
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if( args.count("bcx") ) bc[0] = true;
+    if( args.count("bcy") ) bc[1] = true;
+    if( args.count("bcz") ) bc[2] = true;
+
+    if( args.count("help") ){
+      std::cout << desc << std::endl;
+      return -1;
+    }
+  }
+
+  TestHelper status(true);
+
+  OperatorDatabase opdb;
+  build_stencils( nx, ny, nz, 1.0, 2.0, 3.0, opdb );
+  const OpTypes::GradX&      gradX   = *opdb.retrieve_operator<OpTypes::GradX     >();
+  const OpTypes::GradY&      gradY   = *opdb.retrieve_operator<OpTypes::GradY     >();
+  const OpTypes::DivX&       divX    = *opdb.retrieve_operator<OpTypes::DivX      >();
+  const OpTypes::InterpF2CX& interpX = *opdb.retrieve_operator<OpTypes::InterpF2CX>();
+  const OpTypes::InterpF2CY& interpY = *opdb.retrieve_operator<OpTypes::InterpF2CY>();
+  const SumX sumX;
+
+  // chains of four two-point stencils read two cells away
+  const GhostData ghost(2);
+  const BoundaryCellInfo volbc = BoundaryCellInfo::build<SVolField  >(bc[0],bc[1],bc[2]);
+  const BoundaryCellInfo xbc   = BoundaryCellInfo::build<SSurfXField>(bc[0],bc[1],bc[2]);
+  const BoundaryCellInfo ybc   = BoundaryCellInfo::build<SSurfYField>(bc[0],bc[1],bc[2]);
+  const MemoryWindow volmw = get_window_with_ghost( IntVec(nx,ny,nz), ghost, volbc );
+  const MemoryWindow xmw   = get_window_with_ghost( IntVec(nx,ny,nz), ghost, xbc   );
+  const MemoryWindow ymw   = get_window_with_ghost( IntVec(nx,ny,nz), ghost, ybc   );
+
+  SVolField   phi( volmw, volbc, ghost, NULL );
+  SVolField   vol( volmw, volbc, ghost, NULL );
+  SVolField   ref( volmw, volbc, ghost, NULL );
+  SVolField  test( volmw, volbc, ghost, NULL );
+  SSurfXField   x(   xmw,   xbc, ghost, NULL );
+  SSurfYField   y(   ymw,   ybc, ghost, NULL );
+
+  initialize_field( phi );
+
+  // the chains collapse into single stencils, with the combined coefficients
+  status( points( interpX( gradX( phi ) ) ) == 3, "two point chain: 3 points" );
+  status( coef<-1,0,0>( interpX( gradX( phi ) ) ) == -0.5 * nx &&
+          coef< 0,0,0>( interpX( gradX( phi ) ) ) ==  0.0      &&
+          coef< 1,0,0>( interpX( gradX( phi ) ) ) ==  0.5 * nx, "two point chain coefficients" );
+  status( points( divX( gradX( divX( gradX( phi ) ) ) ) ) == 5, "four stencil chain: 5 points" );
+  status( points( interpY( gradY( interpX( gradX( phi ) ) ) ) ) == 9, "x and y chain: 9 points" );
+  status( points( sumX( sumX( phi ) ) ) == 5, "sum of sum: 5 points" );
+  status( coef<-2,0,0>( sumX( sumX( phi ) ) ) == 1.0 &&
+          coef< 0,0,0>( sumX( sumX( phi ) ) ) == 3.0, "sum of sum coefficients" );
+
+  // and give the results of the stencils one at a time, up to rounding
+  x <<= 0.0;  y <<= 0.0;  vol <<= 0.0;  ref <<= 0.0;  test <<= 0.0;
+  x <<= gradX( phi );
+  ref <<= interpX( x );
+  test <<= interpX( gradX( phi ) );
+  status( interior_fields_close( ref, test, 1e-13 ), "interp( grad )" );
+
+  x <<= gradX( phi );  vol <<= divX( x );  x <<= gradX( vol );
+  ref <<= divX( x );
+  test <<= divX( gradX( divX( gradX( phi ) ) ) );
+  status( interior_fields_close( ref, test, 1e-13 ), "div( grad( div( grad ) ) )" );
+
+  x <<= gradX( phi );  vol <<= interpX( x );  y <<= gradY( vol );
+  ref <<= interpY( y );
+  test <<= interpY( gradY( interpX( gradX( phi ) ) ) );
+  status( interior_fields_close( ref, test, 1e-13 ), "interp( grad ) in x then y" );
+
+  vol <<= sumX( phi );  x <<= gradX( vol );
+  ref <<= divX( x );
+  test <<= divX( gradX( sumX( phi ) ) );
+  status( interior_fields_close( ref, test, 1e-13 ), "stencils of a sum stencil" );
+
+  vol <<= sumX( phi );
+  ref <<= sumX( vol );
+  test <<= sumX( sumX( phi ) );
+  status( interior_fields_close( ref, test, 1e-13 ), "sum of sum" );
+
+  // an expression between the stencils stops the collapse
+  x <<= gradX( phi );
+  ref <<= interpX( x * 2.0 );
+  test <<= interpX( gradX( phi ) * 2.0 );
+  status( interior_fields_close( ref, test, 0.0 ), "interp( 2 * grad )" );
+
+  if( status.ok() ){
+    std::cout << "PASS" << std::endl;
+    return 0;
+  }
+  std::cout << "FAIL" << std::endl;
+  return -1;
+}
@@ -0,0 +1,167 @@
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+#include <spatialops/Nebo.h>
+
+#include <test/TestHelper.h>
+#include <test/FieldHelper.h>
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+
+using namespace SpatialOps;
+using namespace structured;
+namespace po = boost::program_options;
+
+/*
+ * applies the interpolant from SrcT to DestT with runtime coefficients (from
+ * the OperatorDatabase) and with compile-time coefficients: the results
+ * should be identical
+ */
+template<typename OpT, typename SrcT, typename DestT>
+bool compare_interpolant( const OperatorDatabase& opdb,
+                          const IntVec& npts,
+                          const bool* bc )
+{
+  typedef typename OperatorTypeBuilder<OpT,SrcT,DestT>::type RuntimeOp;
+  typedef typename ConstCoefOperatorTypeBuilder<OpT,SrcT,DestT>::type ConstOp;
+
+  const RuntimeOp& runtimeOp = *opdb.retrieve_operator<RuntimeOp>();
+  const ConstOp constOp;
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo srcbc  = BoundaryCellInfo::build<SrcT >(bc[0],bc[1],bc[2]);
+  const BoundaryCellInfo destbc = BoundaryCellInfo::build<DestT>(bc[0],bc[1],bc[2]);
+  const MemoryWindow srcmw  = get_window_with_ghost( npts, ghost, srcbc  );
+  const MemoryWindow destmw = get_window_with_ghost( npts, ghost, destbc );
+
+  SrcT   src( srcmw,  srcbc,  ghost, NULL );
+  DestT  ref( destmw, destbc, ghost, NULL );
+  DestT test( destmw, destbc, ghost, NULL );
+
+  initialize_field( src );
+  ref  <<= 0.0;
+  test <<= 0.0;
+
+  ref  <<= runtimeOp( src );
+  test <<= constOp( src );
+  if( !interior_fields_close( ref, test, 0.0 ) ) return false;
+
+  // and as the argument of an expression
+  ref  <<= runtimeOp( src * 2.0 ) + 1.0;
+  test <<= constOp( src * 2.0 ) + 1.0;
+  return interior_fields_close( ref, test, 0.0 );
+}
+
+int main( int iarg, char* carg[] )
+{
+  int nx, ny, nz;
+  bool bc[] = { false, false, false };
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&nx)->default_value(11), "number of points in x-dir" )
+      ( "ny", po::value<int>(&ny)->default_value(11), "number of points in y-dir" )
+      ( "nz", po::value<int>(&nz)->default_value(11), "number of points in z-dir" )
+      ( "bcx", "physical boundary on +x side?" )
+      ( "bcy", "physical boundary on +y side?" )
+      ( "bcz", "physical boundary on +z side?" );
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if( args.count("bcx") ) bc[0] = true;
+    if( args.count("bcy") ) bc[1] = true;
+    if( args.count("bcz") ) bc[2] = true;
+
+    if( args.count("help") ){
+      std::cout << desc << std::endl;
+      return -1;
+    }
+  }
+
+  TestHelper status(true);
+
+  const IntVec npts(nx,ny,nz);
+  OperatorDatabase opdb;
+  build_stencils( nx, ny, nz, 1.0, 1.0, 1.0, opdb );
+
+  // two-point interpolants
+  status( compare_interpolant<Interpolant,SVolField,SSurfXField>( opdb, npts, bc ), "SVol->SSurfX" );
+  status( compare_interpolant<Interpolant,SVolField,SSurfYField>( opdb, npts, bc ), "SVol->SSurfY" );
+  status( compare_interpolant<Interpolant,SVolField,SSurfZField>( opdb, npts, bc ), "SVol->SSurfZ" );
+  status( compare_interpolant<Interpolant,SSurfXField,SVolField>( opdb, npts, bc ), "SSurfX->SVol" );
+  status( compare_interpolant<Interpolant,SSurfYField,SVolField>( opdb, npts, bc ), "SSurfY->SVol" );
+  status( compare_interpolant<Interpolant,SSurfZField,SVolField>( opdb, npts, bc ), "SSurfZ->SVol" );
+  status( compare_interpolant<Interpolant,XVolField,YSurfXField>( opdb, npts, bc ), "XVol->YSurfX" );
+  status( compare_interpolant<Interpolant,SVolField,XVolField  >( opdb, npts, bc ), "SVol->XVol"   );
+
+  // four-point interpolants
+  status( compare_interpolant<Interpolant,SVolField,XSurfYField>( opdb, npts, bc ), "SVol->XSurfY" );
+  status( compare_interpolant<Interpolant,XSurfZField,SVolField>( opdb, npts, bc ), "XSurfZ->SVol" );
+  status( compare_interpolant<Interpolant,XVolField,YVolField  >( opdb, npts, bc ), "XVol->YVol"   );
+
+  // finite difference interpolants
+  status( compare_interpolant<InterpolantX,SVolField,SVolField>( opdb, npts, bc ), "FD X" );
+  status( compare_interpolant<InterpolantY,SVolField,SVolField>( opdb, npts, bc ), "FD Y" );
+  status( compare_interpolant<InterpolantZ,SVolField,SVolField>( opdb, npts, bc ), "FD Z" );
+
+  // coefficients that differ between points: a centered difference with unit spacing
+  {
+    typedef NeboStencilConstCoefPointCollection<IndexTriplet<-1,0,0>, NeboStencilConstCoef<-1,2>, NeboNil>
+            ::AddPoint<IndexTriplet<1,0,0>, NeboStencilConstCoef<1,2> >::Result ConstPoints;
+    typedef NEBO_FIRST_IJK(-1,0,0)::NEBO_ADD_IJK(1,0,0) RuntimePoints;
+
+    const NeboConstCoefStencilBuilder<GradientX, ConstPoints, SVolField, SVolField> constOp;
+    const NeboStencilBuilder<GradientX, RuntimePoints, SVolField, SVolField> runtimeOp( build_two_point_coef_collection( -0.5, 0.5 ) );
+
+    status( constOp.coefs().get_coef(0) == -0.5 && constOp.coefs().get_coef(1) == 0.5, "centered difference coefficients" );
+
+    const GhostData ghost(1);
+    const BoundaryCellInfo volbc = BoundaryCellInfo::build<SVolField>(bc[0],bc[1],bc[2]);
+    const MemoryWindow volmw = get_window_with_ghost( npts, ghost, volbc );
+    SVolField  phi( volmw, volbc, ghost, NULL );
+    SVolField  ref( volmw, volbc, ghost, NULL );
+    SVolField test( volmw, volbc, ghost, NULL );
+    initialize_field( phi );
+    ref <<= 0.0;  test <<= 0.0;
+
+    ref  <<= runtimeOp( phi );
+    test <<= constOp( phi );
+    status( interior_fields_close( ref, test, 0.0 ), "centered difference" );
+  }
+
+  // stencils with compile-time coefficients collapse with other stencils
+  {
+    typedef BasicOpTypes<SVolField>::GradX GradX;
+    typedef BasicOpTypes<SVolField>::InterpF2CX InterpF2CX;
+    const GradX&      gradX   = *opdb.retrieve_operator<GradX>();
+    const InterpF2CX& interpX = *opdb.retrieve_operator<InterpF2CX>();
+    const ConstCoefOperatorTypeBuilder<Interpolant,SSurfXField,SVolField>::type constInterpX;
+
+    const GhostData ghost(1);
+    const BoundaryCellInfo volbc = BoundaryCellInfo::build<SVolField>(bc[0],bc[1],bc[2]);
+    const MemoryWindow volmw = get_window_with_ghost( npts, ghost, volbc );
+    SVolField  phi( volmw, volbc, ghost, NULL );
+    SVolField  ref( volmw, volbc, ghost, NULL );
+    SVolField test( volmw, volbc, ghost, NULL );
+    initialize_field( phi );
+    ref <<= 0.0;  test <<= 0.0;
+
+    ref  <<= interpX( gradX( phi ) );
+    test <<= constInterpX( gradX( phi ) );
+    status( interior_fields_close( ref, test, 0.0 ), "interp( grad )" );
+  }
+
+  if( status.ok() ){
+    std::cout << "PASS" << std::endl;
+    return 0;
+  }
+  std::cout << "FAIL" << std::endl;
+  return -1;
+}
@@ -343,6 +343,115 @@ bool test_ghost_resize( const IntVec npts )
 }
 
 
+//--------------------------------------------------------------------
+
+template< typename FieldT >
+bool test_padded_store( const IntVec npts )
+{
+  TestHelper status(false);
+
+  typedef typename FieldT::value_type ValT;
+  Pool<ValT>& pool = Pool<ValT>::self();
+  const size_t align = Pool<ValT>::alignment;
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo bc = BoundaryCellInfo::build<FieldT>(true,true,true);
+  const MemoryWindow window( get_window_with_ghost(npts,ghost,bc) );
+
+  FieldT f1( window, bc, ghost, NULL );
+  f1 <<= 1.0;
+  {
+    int i=0;
+    for( typename FieldT::iterator if1=f1.begin(); if1!=f1.end(); ++if1, ++i ) *if1 += i;
+  }
+  status( size_t(f1.field_values()) % align == 0, "pool block alignment" );
+
+  pool.set_row_padding( true );
+  SpatFldPtr<FieldT> f2 = SpatialFieldStore::get_from_window<FieldT>( window, bc, ghost );
+  pool.set_row_padding( false );
+
+  const MemoryWindow& w2 = f2->window_with_ghost();
+  status( w2.glob_dim(0) % (align/sizeof(ValT)) == 0, "padded row pitch" );
+  status( w2.extent() == window.extent(), "padded extent" );
+  for( int k=0; k<w2.extent()[2]; ++k ){
+    for( int j=0; j<w2.extent()[1]; ++j ){
+      const ValT* row = f2->field_values() + w2.flat_index( IntVec(0,j,k) );
+      status( size_t(row) % align == 0, "padded row alignment" );
+    }
+  }
+
+  *f2 <<= 2.0 * f1;
+  typename FieldT::const_iterator if1=f1.begin();
+  typename FieldT::const_iterator if2=f2->begin();
+  for( ; if1!=f1.end(); ++if1, ++if2 ){
+    status( *if2 == 2.0 * *if1 );
+  }
+
+  return status.ok();
+}
+
+//--------------------------------------------------------------------
+
+#ifdef NEBO_NUMA
+struct RecordThread{
+  boost::thread::id* id;
+  CountdownLatch* latch;
+  void operator()() const{ *id = boost::this_thread::get_id(); latch->count_down(); }
+};
+
+bool test_affine_pool()
+{
+  TestHelper status(false);
+
+  ThreadPoolAffine& pool = ThreadPoolAffine::self();
+  const int n = 3*pool.size();
+  std::vector<boost::thread::id> ids(n);
+  CountdownLatch latch(n);
+  for( int p=0; p<n; ++p ){
+    const RecordThread task = { &ids[p], &latch };
+    pool.schedule( p, task );
+  }
+  latch.wait();
+
+  for( int p=0; p<n; ++p ){
+    status( ids[p] == ids[pool.worker_of(p)], "partition runs on its worker" );
+    status( ids[p] != boost::this_thread::get_id(), "partition runs off the master thread" );
+  }
+  return status.ok();
+}
+
+//--------------------------------------------------------------------
+#endif
+
+template<typename FieldT>
+bool test_pool_cache( const IntVec npts )
+{
+  TestHelper status(false);
+
+  typedef typename FieldT::value_type ValT;
+  const Pool<ValT>& pool = Pool<ValT>::self();
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo bc = BoundaryCellInfo::build<FieldT>(true,true,true);
+  const MemoryWindow window( get_window_with_ghost(npts,ghost,bc) );
+
+  { SpatFldPtr<FieldT> f = SpatialFieldStore::get_from_window<FieldT>( window, bc, ghost ); }
+
+  const size_t hits   = pool.cache_hits();
+  const size_t misses = pool.cache_misses();
+  const size_t active = pool.active();
+  for( int i=0; i<4; ++i ){
+    SpatFldPtr<FieldT> f = SpatialFieldStore::get_from_window<FieldT>( window, bc, ghost );
+    status( size_t(f->field_values()) % Pool<ValT>::alignment == 0, "cached block alignment" );
+    status( pool.active() == active+1, "active count" );
+  }
+  status( pool.cache_hits() == hits+4, "cache hits" );
+  status( pool.cache_misses() == misses, "cache misses" );
+  status( pool.active() == active, "blocks returned" );
+
+  return status.ok();
+}
+
 //--------------------------------------------------------------------
 
 int main()
@@ -542,6 +651,17 @@ int main()
     overall( test_ghost_resize<SVolField>(IntVec(5,6,7)), "SVol ghost resize" );
   }
 
+  {
+    overall( test_padded_store<SVolField  >(IntVec(5,6,7)), "SVol padded store" );
+    overall( test_padded_store<XVolField  >(IntVec(9,4,3)), "XVol padded store" );
+    overall( test_padded_store<SSurfXField>(IntVec(16,3,2)), "SSX padded store" );
+    overall( test_pool_cache<SVolField>(IntVec(5,6,7)), "SVol pool cache" );
+  }
+
+# ifdef NEBO_NUMA
+  overall( test_affine_pool(), "affine thread pool" );
+# endif
+
   if( overall.isfailed() ){
     std::cout << "FAIL!" << std::endl;
     return -1;
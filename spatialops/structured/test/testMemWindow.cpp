@@ -195,6 +195,21 @@ int main()
     overall( status.ok(), "Memory window splitting" );
   }
 
+  // test row pitch padding
+  {
+    TestHelper status(false);
+    const MemoryWindow w( IntVec(5,3,2) );
+    const MemoryWindow p = w.pad_row_pitch(8);
+    status( p.glob_dim() == IntVec(8,3,2), "padded glob_dim" );
+    status( p.extent() == w.extent() && p.offset() == w.offset(), "padded extent/offset" );
+    status( 8  == p.flat_index( IntVec(0,1,0) ), "(0,1,0)" );
+    status( 28 == p.flat_index( IntVec(4,0,1) ), "(4,0,1)" );
+    status( w.pad_row_pitch(1) == w, "multiple of 1" );
+    status( MemoryWindow( IntVec(16,3,2) ).pad_row_pitch(8).glob_dim() == IntVec(16,3,2), "already a multiple" );
+    status( MemoryWindow( IntVec(1,3,2) ).pad_row_pitch(8).glob_dim() == IntVec(1,3,2), "one point in x" );
+    overall( status.ok(), "Row pitch padding" );
+  }
+
   if( overall.isfailed() ) return -1;
   return 0;
 }
@@ -75,6 +75,14 @@ namespace boost { namespace threadpool
       }
     }
 
+    /*! Gets the priority of the task.
+    * \return The priority given at construction.
+    */
+    unsigned int priority() const
+    {
+      return m_priority;
+    }
+
     /*! Comparison operator which realises a partial ordering based on priorities.
     * \param rhs The object to compare with.
     * \return true if the priority of *this is less than right hand side's priority, false otherwise.
@@ -21,6 +21,8 @@
  */
 
 #include<spatialops/structured/MemoryWindow.h>
+#include<algorithm>
+#include<cmath>
 
 
 template<typename Field>
@@ -164,3 +166,20 @@ inline bool interior_display_fields_compare(Field const & field1,
                                                 print);
 }
 
+// true if the interiors of the fields differ by at most error times the
+// largest magnitude in field1 (with error 0, if they are equal)
+template<typename Field>
+inline bool interior_fields_close(Field const & field1,
+                                  Field const & field2,
+                                  double const error)
+{
+  typename Field::const_iterator fi1 = field1.interior_begin();
+  typename Field::const_iterator fi2 = field2.interior_begin();
+  double largest = 0.0;
+  double difference = 0.0;
+  for(; fi1 != field1.interior_end(); ++fi1, ++fi2) {
+    largest = std::max(largest, std::abs(*fi1));
+    difference = std::max(difference, std::abs(*fi1 - *fi2));
+  }
+  return difference <= error * largest;
+}
@@ -0,0 +1,132 @@
+#include <iostream>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/FieldComparisons.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+#include <spatialops/Nebo.h>
+#include <test/TestHelper.h>
+#include <test/FieldHelper.h>
+
+//-- boost includes ---//
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+using namespace SpatialOps::structured;
+using std::cout;
+using std::endl;
+
+typedef SVolField Field;
+typedef BasicOpTypes<Field>::InterpC2FX InterpX;
+typedef BasicOpTypes<Field>::DivX       DivX;
+
+int main( int iarg, char* carg[] )
+{
+  int nx, ny, nz;
+  bool bcplus[] = { false, false, false };
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&nx)->default_value(11), "number of points in x-dir" )
+      ( "ny", po::value<int>(&ny)->default_value(9 ), "number of points in y-dir" )
+      ( "nz", po::value<int>(&nz)->default_value(7 ), "number of points in z-dir" )
+      ( "bcx", "physical boundary on +x side?" )
+      ( "bcy", "physical boundary on +y side?" )
+      ( "bcz", "physical boundary on +z side?" );
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if( args.count("bcx") ) bcplus[0] = true;
+    if( args.count("bcy") ) bcplus[1] = true;
+    if( args.count("bcz") ) bcplus[2] = true;
+
+    if( args.count("help") ){
+      cout << desc << endl;
+      return -1;
+    }
+  }
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo bc = BoundaryCellInfo::build<Field>(bcplus[0],bcplus[1],bcplus[2]);
+  const MemoryWindow window( get_window_with_ghost(IntVec(nx,ny,nz),ghost,bc) );
+
+  Field in1( window, bc, ghost, NULL );
+  Field in2( window, bc, ghost, NULL );
+  Field in3( window, bc, ghost, NULL );
+  initialize_field( in1, 0.0 );
+  initialize_field( in2, 1.0 );
+  initialize_field( in3, 2.0 );
+
+  Field ref1( window, bc, ghost, NULL ), test1( window, bc, ghost, NULL );
+  Field ref2( window, bc, ghost, NULL ), test2( window, bc, ghost, NULL );
+  Field ref3( window, bc, ghost, NULL ), test3( window, bc, ghost, NULL );
+  Field ref4( window, bc, ghost, NULL ), test4( window, bc, ghost, NULL );
+
+  TestHelper status(true);
+
+  // two statements sharing an operand
+  ref1 <<= sin(in1) * in2;
+  ref2 <<= sin(in1) - in3;
+  nebo_fused_assign( nebo_statement( test1, sin(in1) * in2 ),
+                     nebo_statement( test2, sin(in1) - in3 ) );
+  status( field_equal( ref1, test1, 0.0 ) && field_equal( ref2, test2, 0.0 ), "two statements" );
+
+  // field and scalar right-hand sides, four statements
+  ref1 <<= in3;
+  ref2 <<= 4.0;
+  ref3 <<= in1 + in2 + in3;
+  ref4 <<= cond( in1 > in2, in1 )( in2 );
+  nebo_fused_assign( nebo_statement( test1, in3 ),
+                     nebo_statement( test2, 4.0 ),
+                     nebo_statement( test3, in1 + in2 + in3 ),
+                     nebo_statement( test4, cond( in1 > in2, in1 )( in2 ) ) );
+  status( field_equal( ref1, test1, 0.0 ) && field_equal( ref2, test2, 0.0 )
+       && field_equal( ref3, test3, 0.0 ) && field_equal( ref4, test4, 0.0 ), "four statements" );
+
+  // a stencil limits the ghost cells of every statement to its own
+  {
+    OperatorDatabase sodb;
+    build_stencils( nx, ny, nz, 1.0, 1.0, 1.0, sodb );
+    const InterpX& interp = *sodb.retrieve_operator<InterpX>();
+    const DivX&    div    = *sodb.retrieve_operator<DivX>();
+
+    ref1 <<= 0.0;  ref2 <<= 0.0;
+    test1 <<= 0.0; test2 <<= 0.0;
+    ref1 <<= div( interp( in1 ) );
+    ref2 <<= in2 * in3 + 0.0 * div( interp( in1 ) );
+    nebo_fused_assign( nebo_statement( test1, div( interp( in1 ) ) ),
+                       nebo_statement( test2, in2 * in3 ) );
+    status( field_equal( ref1, test1, 0.0 ), "stencil statement" );
+    status( field_equal( ref2, test2, 0.0 ), "pointwise statement fused with a stencil" );
+  }
+
+  // statements over different extents cannot be fused
+  {
+    const MemoryWindow window2( get_window_with_ghost(IntVec(nx+1,ny,nz),ghost,bc) );
+    Field other( window2, bc, ghost, NULL );
+    bool threw = false;
+    try{
+      nebo_fused_assign( nebo_statement( test1, in1 ), nebo_statement( other, 1.0 ) );
+    }
+    catch( std::runtime_error& ){
+      threw = true;
+    }
+    status( threw, "mismatched extents" );
+  }
+
+  if( status.ok() ){
+    cout << "PASS" << endl;
+    return 0;
+  }
+  cout << "FAIL" << endl;
+  return -1;
+}
@@ -0,0 +1,147 @@
+#include <iostream>
+#include <stdexcept>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/FieldComparisons.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+#include <spatialops/Nebo.h>
+#include <test/TestHelper.h>
+#include <test/FieldHelper.h>
+
+//-- boost includes ---//
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+using namespace SpatialOps::structured;
+using std::cout;
+using std::endl;
+
+typedef SVolField Field;
+typedef BasicOpTypes<Field>::InterpC2FX InterpX;
+typedef BasicOpTypes<Field>::DivX       DivX;
+
+double const & fold_sum( double const & a, double const & b ){ static double r; r = a + b; return r; }
+
+bool close( const double a, const double b ){
+  return std::abs( a - b ) <= 1e-12 * std::abs(b);
+}
+
+int main( int iarg, char* carg[] )
+{
+  int nx, ny, nz;
+  bool bcplus[] = { false, false, false };
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&nx)->default_value(21), "number of points in x-dir" )
+      ( "ny", po::value<int>(&ny)->default_value(9 ), "number of points in y-dir" )
+      ( "nz", po::value<int>(&nz)->default_value(13), "number of points in z-dir" )
+      ( "bcx", "physical boundary on +x side?" )
+      ( "bcy", "physical boundary on +y side?" )
+      ( "bcz", "physical boundary on +z side?" );
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if( args.count("bcx") ) bcplus[0] = true;
+    if( args.count("bcy") ) bcplus[1] = true;
+    if( args.count("bcz") ) bcplus[2] = true;
+
+    if( args.count("help") ){
+      cout << desc << endl;
+      return -1;
+    }
+  }
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo bc = BoundaryCellInfo::build<Field>(bcplus[0],bcplus[1],bcplus[2]);
+  const MemoryWindow window( get_window_with_ghost(IntVec(nx,ny,nz),ghost,bc) );
+
+  Field a  ( window, bc, ghost, NULL );
+  Field b  ( window, bc, ghost, NULL );
+  Field f  ( window, bc, ghost, NULL );
+  Field ref( window, bc, ghost, NULL );
+  initialize_field( a, 0.0 );
+  initialize_field( b, 1.0 );
+
+  OperatorDatabase sodb;
+  build_stencils( nx, ny, nz, 1.0, 1.0, 1.0, sodb );
+  const InterpX& interp = *sodb.retrieve_operator<InterpX>();
+  const DivX&    div    = *sodb.retrieve_operator<DivX>();
+
+  NeboVariable<Field> k, m;
+
+  TestHelper status(true);
+
+# ifdef FIELD_EXPRESSION_THREADS
+  const int threads[] = { 1, 2, NTHREADS, 3*NTHREADS };
+  for( int t=0; t<4; ++t ){
+    set_hard_thread_count( threads[t] );
+    set_soft_thread_count( threads[t] );
+# endif
+
+    f   <<= nebo_let( k, sin(a) * b, k * k + k - b / k );
+    ref <<= sin(a) * b * (sin(a) * b) + sin(a) * b - b / (sin(a) * b);
+    status( field_equal( f, ref, 0.0 ), "let" );
+
+    f   <<= nebo_let( k, a, k );
+    status( field_equal( f, a, 0.0 ), "variable body" );
+
+    f   <<= nebo_let( k, exp( -a ), cond( k > 0.5, k )( b * k ) );
+    ref <<= cond( exp( -a ) > 0.5, exp( -a ) )( b * exp( -a ) );
+    status( field_equal( f, ref, 0.0 ), "cond body" );
+
+    // two variables, and a variable bound again within its own body
+    f   <<= nebo_let( k, a, nebo_let( m, k + b, k * m ) + nebo_let( k, k + 1.0, 2.0 * k ) + k );
+    ref <<= a * (a + b) + 2.0 * (a + 1.0) + a;
+    status( field_equal( f, ref, 0.0 ), "nested" );
+
+    // stencils applied to a whole let
+    f   <<= 0.0;
+    ref <<= 0.0;
+    f   <<= div( interp( nebo_let( k, a + b, k * k ) ) );
+    ref <<= div( interp( (a + b) * (a + b) ) );
+    status( field_equal( f, ref, 0.0 ), "stencil of let" );
+
+    status( nebo_max( nebo_let( k, sin(a), k * k ) ) == nebo_max( sin(a) * sin(a) ), "reduce" );
+    status( close( nebo_sum( nebo_let( k, sin(a), k * k ) ), nebo_sum( sin(a) * sin(a) ) ), "reduce sum" );
+    status( nebo_fold( fold_sum, 0.0, nebo_let( k, sin(a), k * k ) )
+         == nebo_fold( fold_sum, 0.0, sin(a) * sin(a) ), "fold" );
+
+# ifdef FIELD_EXPRESSION_THREADS
+  }
+# endif
+
+  // a variable is only defined at the point being evaluated
+  try{
+    f <<= nebo_let( k, a, div( interp( k ) ) );
+    status( false, "shifted variable" );
+  }
+  catch( std::runtime_error& ){
+    status( true, "shifted variable" );
+  }
+
+  try{
+    f <<= k + a;
+    status( false, "unbound variable" );
+  }
+  catch( std::runtime_error& ){
+    status( true, "unbound variable" );
+  }
+
+  if( status.ok() ){
+    cout << "PASS" << endl;
+    return 0;
+  }
+  cout << "FAIL" << endl;
+  return -1;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+
+//-- boost includes ---//
+#include <boost/program_options.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+namespace SS = SpatialOps::structured;
+
+/*
+ * Measures the cost of OperatorDatabase::retrieve_operator on a database
+ * filled by build_stencils:
+ *
+ *  - first: an operator that build_stencils registers early
+ *  - last:  an operator that build_stencils registers late
+ *  - mixed: a round of twelve lookups, of the basic operators on each volume
+ *
+ * Times are reported per lookup in nanoseconds.
+ */
+
+template<typename OpT>
+inline size_t lookup( const OperatorDatabase& opdb )
+{
+  return size_t( opdb.retrieve_operator<OpT>() );
+}
+
+template<typename OpT>
+double time_lookup( const OperatorDatabase& opdb, const int runs )
+{
+  size_t check = 0;
+  const boost::posix_time::ptime start( boost::posix_time::microsec_clock::universal_time() );
+  for( int run=0; run<runs; ++run ) check += lookup<OpT>( opdb );
+  const boost::posix_time::ptime end( boost::posix_time::microsec_clock::universal_time() );
+  if( check == 0 ) std::cout << "no operator" << std::endl;   // keeps the lookups
+  return 1000.0 * double((end-start).total_microseconds()) / runs;
+}
+
+template<typename VolT>
+size_t lookup_basic( const OperatorDatabase& opdb )
+{
+  typedef SS::BasicOpTypes<VolT> Ops;
+  return lookup<typename Ops::InterpC2FX>( opdb ) + lookup<typename Ops::InterpF2CX>( opdb )
+       + lookup<typename Ops::GradX     >( opdb ) + lookup<typename Ops::DivX      >( opdb );
+}
+
+double time_mixed( const OperatorDatabase& opdb, const int runs )
+{
+  size_t check = 0;
+  const boost::posix_time::ptime start( boost::posix_time::microsec_clock::universal_time() );
+  for( int run=0; run<runs; ++run ){
+    check += lookup_basic<SS::SVolField>( opdb )
+           + lookup_basic<SS::XVolField>( opdb )
+           + lookup_basic<SS::ZVolField>( opdb );
+  }
+  const boost::posix_time::ptime end( boost::posix_time::microsec_clock::universal_time() );
+  if( check == 0 ) std::cout << "no operator" << std::endl;
+  return 1000.0 * double((end-start).total_microseconds()) / runs / 12;
+}
+
+int main( int iarg, char* carg[] )
+{
+  int number_of_runs;
+
+  // parse the command line options input describing the problem
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "runs", po::value<int>(&number_of_runs)->default_value(1000000), "Number of lookups to time");
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if (args.count("help")) {
+      std::cout << desc << "\n";
+      return 1;
+    }
+  }
+
+  OperatorDatabase opdb;
+  SS::build_stencils( 16, 16, 16, 1.0, 1.0, 1.0, opdb );
+
+  typedef SS::BasicOpTypes<SS::SVolField>::InterpC2FX First;
+  typedef SS::OperatorTypeBuilder<GradientZ,SS::ZVolField,SS::ZVolField>::type Last;
+
+  std::cout << "first ns/lookup: " << time_lookup<First>( opdb, number_of_runs ) << std::endl
+            << "last  ns/lookup: " << time_lookup<Last >( opdb, number_of_runs ) << std::endl
+            << "mixed ns/lookup: " << time_mixed( opdb, number_of_runs / 12 )    << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+#include <iostream>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/FieldComparisons.h>
+#include <spatialops/structured/SpatialFieldStore.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+#include <spatialops/Nebo.h>
+#include <test/TestHelper.h>
+#include <test/FieldHelper.h>
+
+//-- boost includes ---//
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+using namespace SpatialOps::structured;
+using std::cout;
+using std::endl;
+
+typedef SVolField   CellField;
+typedef SSurfXField XSideField;
+
+typedef BasicOpTypes<CellField>::GradX      GradX;
+typedef BasicOpTypes<CellField>::InterpC2FX InterpX;
+typedef BasicOpTypes<CellField>::DivX       DivX;
+
+/*
+ * One step of a 1-D diffusion update written as a chain of Nebo
+ * assignments: pointwise statements that can run back to back and
+ * stencils that force a barrier, with a temporary from the
+ * SpatialFieldStore that is released while the statements may still be
+ * running.
+ */
+void step( const GradX& grad, const InterpX& interp, const DivX& div,
+           const CellField& phi, const CellField& cond,
+           XSideField& flux, CellField& a, CellField& b, CellField& rhs )
+{
+  a <<= 2.0 * phi + 1.0;
+  b <<= a * a - phi;
+  a <<= b / ( 1.0 + a );
+  {
+    SpatFldPtr<XSideField> tmp = SpatialFieldStore::get<XSideField>( flux );
+    *tmp <<= interp( cond );
+    flux <<= -grad( a ) * *tmp;
+  }
+  rhs <<= div( flux );
+  rhs <<= rhs + b;
+}
+
+int main( int iarg, char* carg[] )
+{
+  int nx, ny, nz, partitions;
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&nx)->default_value(20), "number of points in x-dir" )
+      ( "ny", po::value<int>(&ny)->default_value(12), "number of points in y-dir" )
+      ( "nz", po::value<int>(&nz)->default_value(16), "number of points in z-dir" )
+      ( "partitions", po::value<int>(&partitions)->default_value(2*NTHREADS+1), "number of partitions per field" );
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if( args.count("help") ){
+      cout << desc << endl;
+      return -1;
+    }
+  }
+
+  OperatorDatabase sodb;
+  build_stencils( nx, ny, nz, 1.0, 1.0, 1.0, sodb );
+  const GradX&   grad   = *sodb.retrieve_operator<GradX  >();
+  const InterpX& interp = *sodb.retrieve_operator<InterpX>();
+  const DivX&    div    = *sodb.retrieve_operator<DivX   >();
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo cellBC = BoundaryCellInfo::build<CellField >(true,true,true);
+  const BoundaryCellInfo xBC    = BoundaryCellInfo::build<XSideField>(true,true,true);
+  const MemoryWindow cwindow( get_window_with_ghost(IntVec(nx,ny,nz),ghost,cellBC) );
+  const MemoryWindow xwindow( get_window_with_ghost(IntVec(nx,ny,nz),ghost,xBC   ) );
+
+  CellField phi ( cwindow, cellBC, ghost, NULL );
+  CellField cond( cwindow, cellBC, ghost, NULL );
+  initialize_field( phi,  0.0 );
+  initialize_field( cond, 1.0 );
+  cond <<= 1.0 + 1.0/cond;
+
+  CellField  a1( cwindow, cellBC, ghost, NULL ),  a2( cwindow, cellBC, ghost, NULL );
+  CellField  b1( cwindow, cellBC, ghost, NULL ),  b2( cwindow, cellBC, ghost, NULL );
+  CellField  r1( cwindow, cellBC, ghost, NULL ),  r2( cwindow, cellBC, ghost, NULL );
+  XSideField f1( xwindow, xBC,    ghost, NULL ),  f2( xwindow, xBC,    ghost, NULL );
+
+  a2.set_partition_count( partitions );
+  b2.set_partition_count( partitions );
+  r2.set_partition_count( partitions );
+  f2.set_partition_count( partitions );
+
+  TestHelper status(true);
+
+  // reference: every statement joins before the next one starts
+  step( grad, interp, div, phi, cond, f1, a1, b1, r1 );
+
+  for( int rep=0; rep<20; ++rep ){
+    NeboParallelRegion region;
+    step( grad, interp, div, phi, cond, f2, a2, b2, r2 );
+    region.sync();
+    status( NeboParallelRegion::current() == &region, "region is current" );
+    step( grad, interp, div, phi, cond, f2, a2, b2, r2 );
+  }
+
+  status( NeboParallelRegion::current() == NULL, "no region after scope" );
+  status( field_equal( a1, a2, 0.0 ), "pointwise result"  );
+  status( field_equal( b1, b2, 0.0 ), "chained pointwise" );
+  status( field_equal( f1, f2, 0.0 ), "stencil result"    );
+  status( field_equal( r1, r2, 0.0 ), "final result"      );
+
+  // a nested region runs the rest of the outer one first
+  {
+    NeboParallelRegion outer;
+    a2 <<= 3.0 * phi;
+    {
+      NeboParallelRegion inner;
+      status( NeboParallelRegion::current() == &inner, "inner region is current" );
+      b2 <<= a2 + 1.0;
+    }
+    status( NeboParallelRegion::current() == &outer, "outer region is restored" );
+  }
+  a1 <<= 3.0 * phi;
+  b1 <<= a1 + 1.0;
+  status( field_equal( b1, b2, 0.0 ), "nested regions" );
+
+  if( status.ok() ){
+    cout << "PASS" << endl;
+    return 0;
+  }
+  cout << "FAIL" << endl;
+  return -1;
+}
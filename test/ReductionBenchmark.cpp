@@ -0,0 +1,104 @@
+#include <iostream>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/Nebo.h>
+
+//-- boost includes ---//
+#include <boost/program_options.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+namespace SS = SpatialOps::structured;
+
+/*
+ * Measures what reproducible reductions cost over the default ones:
+ *
+ *  - sum:  nebo_sum against nebo_sum_reproducible
+ *  - norm: nebo_norm against nebo_norm_reproducible
+ *
+ * of an expression of two fields.  Times are reported per reduction in
+ * microseconds, with the ratio of the reproducible time to the default time.
+ * (Under NEBO_REPRODUCIBLE_REDUCTIONS both columns are reproducible.)
+ */
+
+typedef SS::SVolField Field;
+
+template<typename Reduction>
+double time_reduction( const Reduction reduction, const Field& a, const Field& b, const int runs )
+{
+  double result = 0.0;
+  const boost::posix_time::ptime start( boost::posix_time::microsec_clock::universal_time() );
+  for( int run=0; run<runs; ++run ) result += reduction( a, b );
+  const boost::posix_time::ptime end( boost::posix_time::microsec_clock::universal_time() );
+  if( result != result ) std::cout << "NaN result" << std::endl;   // keeps the reductions
+  return double((end-start).total_microseconds()) / runs;
+}
+
+double fast_sum         ( const Field& a, const Field& b ){ return nebo_sum              ( a * b + 1.0 ); }
+double reproducible_sum ( const Field& a, const Field& b ){ return nebo_sum_reproducible ( a * b + 1.0 ); }
+double fast_norm        ( const Field& a, const Field& b ){ return nebo_norm             ( a * b + 1.0 ); }
+double reproducible_norm( const Field& a, const Field& b ){ return nebo_norm_reproducible( a * b + 1.0 ); }
+
+void report( const std::string& name, const double fast, const double reproducible )
+{
+  std::cout << name
+            << " us/reduction: " << fast
+            << " reproducible us/reduction: " << reproducible
+            << " ratio: " << reproducible / fast
+            << std::endl;
+}
+
+int main( int iarg, char* carg[] )
+{
+  std::vector<int> npts(3,1);
+  int number_of_runs;
+# ifdef FIELD_EXPRESSION_THREADS
+  int thread_count;
+# endif
+
+  // parse the command line options input describing the problem
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&npts[0])->default_value(64), "Grid in x" )
+      ( "ny", po::value<int>(&npts[1])->default_value(64), "Grid in y" )
+      ( "nz", po::value<int>(&npts[2])->default_value(64), "Grid in z" )
+#     ifdef FIELD_EXPRESSION_THREADS
+      ( "tc", po::value<int>(&thread_count)->default_value(NTHREADS), "Number of threads for Nebo")
+#     endif
+      ( "runs", po::value<int>(&number_of_runs)->default_value(100), "Number of reductions to time");
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if (args.count("help")) {
+      std::cout << desc << "\n";
+      return 1;
+    }
+
+#   ifdef FIELD_EXPRESSION_THREADS
+    set_hard_thread_count(thread_count);
+#   endif
+  }
+
+  const SS::GhostData ghost(1);
+  const SS::BoundaryCellInfo bc = SS::BoundaryCellInfo::build<Field>(true,true,true);
+  const SS::MemoryWindow window( SS::get_window_with_ghost(npts,ghost,bc) );
+
+  Field a( window, bc, ghost, NULL );
+  Field b( window, bc, ghost, NULL );
+  a <<= 0.5;
+  b <<= 3.0;
+
+  report( "sum ", time_reduction( &fast_sum,  a, b, number_of_runs ), time_reduction( &reproducible_sum,  a, b, number_of_runs ) );
+  report( "norm", time_reduction( &fast_norm, a, b, number_of_runs ), time_reduction( &reproducible_norm, a, b, number_of_runs ) );
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <cmath>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/OperatorDatabase.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/structured/stencil/FVStaggeredOperatorTypes.h>
+#include <spatialops/structured/stencil/StencilBuilder.h>
+#include <spatialops/Nebo.h>
+#include <test/TestHelper.h>
+#include <test/FieldHelper.h>
+
+//-- boost includes ---//
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+using namespace SpatialOps::structured;
+using std::cout;
+using std::endl;
+
+typedef SVolField Field;
+typedef BasicOpTypes<Field>::InterpC2FX InterpX;
+typedef BasicOpTypes<Field>::DivX       DivX;
+
+/* nebo_fold is not split up, so it gives the reference results */
+double const & fold_max( double const & a, double const & b ){ return std::max(a,b); }
+double const & fold_min( double const & a, double const & b ){ return std::min(a,b); }
+double const & fold_sum( double const & a, double const & b ){ static double r; r = a + b; return r; }
+double const & fold_abs_max( double const & a, double const & b ){ static double r; r = std::max( a, std::abs(b) ); return r; }
+
+/* a user-defined reduction operator */
+struct AbsMax{
+  double operator()( const double a, const double b ) const{ return std::max( std::abs(a), std::abs(b) ); }
+};
+
+typedef NeboReduceList< NeboReduceMax<double>,
+                        NeboReduceMin<double>,
+                        NeboReduceSum<double>,
+                        NeboReduceNorm<double> > Stats;
+
+bool close( const double a, const double b ){
+  return std::abs( a - b ) <= 1e-12 * std::abs(b);
+}
+
+int main( int iarg, char* carg[] )
+{
+  int nx, ny, nz;
+  bool bcplus[] = { false, false, false };
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&nx)->default_value(21), "number of points in x-dir" )
+      ( "ny", po::value<int>(&ny)->default_value(9 ), "number of points in y-dir" )
+      ( "nz", po::value<int>(&nz)->default_value(13), "number of points in z-dir" )
+      ( "bcx", "physical boundary on +x side?" )
+      ( "bcy", "physical boundary on +y side?" )
+      ( "bcz", "physical boundary on +z side?" );
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if( args.count("bcx") ) bcplus[0] = true;
+    if( args.count("bcy") ) bcplus[1] = true;
+    if( args.count("bcz") ) bcplus[2] = true;
+
+    if( args.count("help") ){
+      cout << desc << endl;
+      return -1;
+    }
+  }
+
+  const GhostData ghost(1);
+  const BoundaryCellInfo bc = BoundaryCellInfo::build<Field>(bcplus[0],bcplus[1],bcplus[2]);
+  const MemoryWindow window( get_window_with_ghost(IntVec(nx,ny,nz),ghost,bc) );
+
+  Field a( window, bc, ghost, NULL );
+  Field b( window, bc, ghost, NULL );
+  initialize_field( a, 0.0 );
+  initialize_field( b, 1.0 );
+
+  OperatorDatabase sodb;
+  build_stencils( nx, ny, nz, 1.0, 1.0, 1.0, sodb );
+  const InterpX& interp = *sodb.retrieve_operator<InterpX>();
+  const DivX&    div    = *sodb.retrieve_operator<DivX>();
+
+  // the Reduction mode (nebo_fold) does not take stencils, so reduce their result instead
+  Field divInterp( window, bc, ghost, NULL );
+  divInterp <<= div( interp( a ) );
+
+  TestHelper status(true);
+
+# ifdef FIELD_EXPRESSION_THREADS
+  // from one partition up to more partitions than planes
+  const int threads[] = { 1, 2, NTHREADS, 3*NTHREADS };
+  for( int t=0; t<4; ++t ){
+    set_hard_thread_count( threads[t] );
+    set_soft_thread_count( threads[t] );
+# endif
+
+    status( nebo_max( a*b ) == nebo_fold( fold_max, -1e300, a*b ), "max" );
+    status( nebo_min( a*b ) == nebo_fold( fold_min,  1e300, a*b ), "min" );
+    status( close( nebo_sum( a*b ), nebo_fold( fold_sum, 0.0, a*b ) ), "sum" );
+    status( close( nebo_norm( a ), std::sqrt( nebo_fold( fold_sum, 0.0, a*a ) ) ), "norm" );
+
+    status( nebo_max_interior( a*b ) == nebo_fold_interior( fold_max, -1e300, a*b ), "max interior" );
+    status( close( nebo_sum_interior( a ), nebo_fold_interior( fold_sum, 0.0, a ) ), "sum interior" );
+
+    status( nebo_reduce( AbsMax(), sin(a) - b ) == nebo_fold( fold_abs_max, 0.0, sin(a) - b ), "functor" );
+    status( nebo_reduce( fold_max, a ) == nebo_max( a ), "function pointer" );
+    status( nebo_reduce( NeboReduceMax<double>(), cond( a > b, a )( b ) )
+         == nebo_fold( fold_max, -1e300, cond( a > b, a )( b ) ), "cond" );
+
+    // one pass gives the same results as separate reductions
+    const Stats::Values<double> stats = nebo_reduce_many( Stats(), sin(a) * b );
+    status( stats.get<0>() == nebo_max ( sin(a) * b ), "many max"  );
+    status( stats.get<1>() == nebo_min ( sin(a) * b ), "many min"  );
+    status( stats.get<2>() == nebo_sum ( sin(a) * b ), "many sum"  );
+    status( stats.get<3>() == nebo_norm( sin(a) * b ), "many norm" );
+
+    const Stats::Values<double> interior = nebo_reduce_many_interior( Stats(), a );
+    status( interior.get<0>() == nebo_max_interior ( a ), "many max interior"  );
+    status( interior.get<2>() == nebo_sum_interior ( a ), "many sum interior"  );
+    status( interior.get<3>() == nebo_norm_interior( a ), "many norm interior" );
+
+    typedef NeboReduceList< double const & (*)( double const &, double const & ), AbsMax > UserOps;
+    const UserOps::Values<double> user = nebo_reduce_many( UserOps( fold_min ), a - b );
+    status( user.get<0>() == nebo_min( a - b ) && user.get<1>() == nebo_reduce( AbsMax(), a - b ), "many user operators" );
+
+    status( close( nebo_sum_reproducible( a*b ), nebo_fold( fold_sum, 0.0, a*b ) ), "reproducible sum" );
+    status( close( nebo_norm_reproducible_interior( a ), nebo_norm_interior( a ) ), "reproducible norm interior" );
+
+    status( nebo_max_interior( div( interp( a ) ) ) == nebo_max_interior( divInterp ), "stencil max" );
+    status( close( nebo_sum_interior( div( interp( a ) ) ), nebo_sum_interior( divInterp ) ), "stencil sum" );
+
+# ifdef FIELD_EXPRESSION_THREADS
+  }
+# endif
+
+  // a compensated sum keeps the small values next to large ones that cancel
+  {
+    Field c( window, bc, ghost, NULL );
+    c <<= 1.0;
+    Field::iterator last = c.begin();
+    for( Field::iterator i = c.begin(); i != c.end(); ++i ) last = i;
+    *c.begin() = 1e100;
+    *last = -1e100;
+    status( nebo_sum_reproducible( c ) == double( c.window_with_ghost().local_npts() - 2 ), "compensated sum" );
+  }
+
+# ifdef FIELD_EXPRESSION_THREADS
+  // reproducible reductions do not depend on the thread count
+  {
+    set_soft_thread_count( 1 );
+    const double sum  = nebo_sum_reproducible ( sin(a) * b );
+    const double norm = nebo_norm_reproducible( sin(a) * b );
+    for( int t=1; t<4; ++t ){
+      set_soft_thread_count( threads[t] );
+      status( nebo_sum_reproducible ( sin(a) * b ) == sum,  "reproducible sum threads"  );
+      status( nebo_norm_reproducible( sin(a) * b ) == norm, "reproducible norm threads" );
+    }
+  }
+# endif
+
+  if( status.ok() ){
+    cout << "PASS" << endl;
+    return 0;
+  }
+  cout << "FAIL" << endl;
+  return -1;
+}
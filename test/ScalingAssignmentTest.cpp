@@ -315,6 +315,30 @@ int main( int iarg, char* carg[] )
 	    result <<= ((f01_ + f04_ + f07_) * (f10_ + f13_ + f16_)) / ((f19_ + f22_ + f25_) * (f28_ + f31_ + f34_)),
 	    "13-loop");
 
+  //5 Loop, with the four independent statements fused into one traversal
+  RUN_TESTS(nebo_fused_assign(nebo_statement(f01_, (sin(f01) - sin(f02) - sin(f03)) + (sin(f04) - sin(f05) - sin(f06)) + (sin(f07) - sin(f08) - sin(f09))),
+			      nebo_statement(f10_, (sin(f10) - sin(f11) - sin(f12)) + (sin(f13) - sin(f14) - sin(f15)) + (sin(f16) - sin(f17) - sin(f18))),
+			      nebo_statement(f19_, (sin(f19) - sin(f20) - sin(f21)) + (sin(f22) - sin(f23) - sin(f24)) + (sin(f25) - sin(f26) - sin(f27))),
+			      nebo_statement(f28_, (sin(f28) - sin(f29) - sin(f30)) + (sin(f31) - sin(f32) - sin(f33)) + (sin(f34) - sin(f35) - sin(f36))));
+	    result <<= (f01_ * f10_) / (f19_ * f28_),
+	    "5-loop fused");
+
+  //13 Loop, with the twelve independent statements fused four at a time
+  RUN_TESTS(nebo_fused_assign(nebo_statement(f01_, sin(f01) - sin(f02) - sin(f03)),
+			      nebo_statement(f04_, sin(f04) - sin(f05) - sin(f06)),
+			      nebo_statement(f07_, sin(f07) - sin(f08) - sin(f09)),
+			      nebo_statement(f10_, sin(f10) - sin(f11) - sin(f12)));
+	    nebo_fused_assign(nebo_statement(f13_, sin(f13) - sin(f14) - sin(f15)),
+			      nebo_statement(f16_, sin(f16) - sin(f17) - sin(f18)),
+			      nebo_statement(f19_, sin(f19) - sin(f20) - sin(f21)),
+			      nebo_statement(f22_, sin(f22) - sin(f23) - sin(f24)));
+	    nebo_fused_assign(nebo_statement(f25_, sin(f25) - sin(f26) - sin(f27)),
+			      nebo_statement(f28_, sin(f28) - sin(f29) - sin(f30)),
+			      nebo_statement(f31_, sin(f31) - sin(f32) - sin(f33)),
+			      nebo_statement(f34_, sin(f34) - sin(f35) - sin(f36)));
+	    result <<= ((f01_ + f04_ + f07_) * (f10_ + f13_ + f16_)) / ((f19_ + f22_ + f25_) * (f28_ + f31_ + f34_)),
+	    "13-loop fused");
+
   //35 Loop
   RUN_TESTS(f01_ <<= (sin(f01) - sin(f02));
 	    f01__ <<= (f01_ - sin(f03));
@@ -0,0 +1,110 @@
+#include <iostream>
+
+//--- SpatialOps includes ---//
+#include <spatialops/SpatialOpsConfigure.h>
+#include <spatialops/structured/FVTools.h>
+#include <spatialops/structured/FVStaggeredFieldTypes.h>
+#include <spatialops/Nebo.h>
+#include <spatialops/ThreadPool.h>
+#include <spatialops/CountdownLatch.h>
+
+//-- boost includes ---//
+#include <boost/bind.hpp>
+#include <boost/program_options.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+namespace po = boost::program_options;
+
+using namespace SpatialOps;
+namespace SS = SpatialOps::structured;
+
+/*
+ * Measures the cost of handing work to the thread pool that backs Nebo's
+ * threaded assignments:
+ *
+ *  - dispatch: schedule a batch of empty tasks and wait for all of them, as
+ *    a thread-parallel assignment does with its partitions.
+ *  - assign:   a Nebo assignment to a small field split into many partitions,
+ *    where the dispatch cost dominates the arithmetic.
+ *
+ * Times are reported per batch (per assignment) in microseconds.
+ */
+
+static void empty_task( CountdownLatch* latch ){ latch->count_down(); }
+
+int main( int iarg, char* carg[] )
+{
+  typedef SS::SVolField Field;
+
+  std::vector<int> npts(3,1);
+  int number_of_runs;
+  int partitions;
+  int thread_count;
+
+  // parse the command line options input describing the problem
+  {
+    po::options_description desc("Supported Options");
+    desc.add_options()
+      ( "help", "print help message" )
+      ( "nx", po::value<int>(&npts[0])->default_value(16), "Grid in x" )
+      ( "ny", po::value<int>(&npts[1])->default_value(16), "Grid in y" )
+      ( "nz", po::value<int>(&npts[2])->default_value(64), "Grid in z" )
+      ( "tc", po::value<int>(&thread_count)->default_value(NTHREADS), "Number of threads for Nebo")
+      ( "partitions", po::value<int>(&partitions)->default_value(64), "Number of tasks (partitions) per batch" )
+      ( "runs", po::value<int>(&number_of_runs)->default_value(1000), "Number of batches to time");
+
+    po::variables_map args;
+    po::store( po::parse_command_line(iarg,carg,desc), args );
+    po::notify(args);
+
+    if (args.count("help")) {
+      std::cout << desc << "\n";
+      return 1;
+    }
+
+    set_hard_thread_count(thread_count);
+  }
+
+  // raw task dispatch
+  {
+    const boost::posix_time::ptime start( boost::posix_time::microsec_clock::universal_time() );
+    for( int run=0; run<number_of_runs; ++run ){
+      CountdownLatch latch( partitions );
+      for( int i=0; i<partitions; ++i ){
+        ThreadPoolFIFO::self().schedule( boost::bind( &empty_task, &latch ) );
+      }
+      latch.wait();
+    }
+    const boost::posix_time::ptime end( boost::posix_time::microsec_clock::universal_time() );
+    std::cout << "dispatch threads: " << thread_count
+              << " tasks: " << partitions
+              << " runs: " << number_of_runs
+              << " us/batch: " << double((end-start).total_microseconds())/number_of_runs
+              << std::endl;
+  }
+
+  // Nebo assignment over many partitions
+  {
+    const SS::GhostData ghost(1);
+    const SS::BoundaryCellInfo bc = SS::BoundaryCellInfo::build<Field>(true,true,true);
+    const SS::MemoryWindow window( SS::get_window_with_ghost(npts,ghost,bc) );
+
+    Field a( window, bc, ghost, NULL );
+    Field b( window, bc, ghost, NULL );
+    a.set_partition_count( partitions );
+    b <<= 1.0;
+
+    const boost::posix_time::ptime start( boost::posix_time::microsec_clock::universal_time() );
+    for( int run=0; run<number_of_runs; ++run ){
+      a <<= 2.0 * b + 1.0;
+    }
+    const boost::posix_time::ptime end( boost::posix_time::microsec_clock::universal_time() );
+    std::cout << "assign   threads: " << thread_count
+              << " partitions: " << partitions
+              << " runs: " << number_of_runs
+              << " us/assign: " << double((end-start).total_microseconds())/number_of_runs
+              << std::endl;
+  }
+
+  return 0;
+}
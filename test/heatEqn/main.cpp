@@ -156,6 +156,11 @@ int main( int iarg, char* carg[] )
 
       using namespace SpatialOps;
 
+#     ifdef FIELD_EXPRESSION_THREADS
+      // run the assignments of this step without a fork/join after each one
+      NeboParallelRegion region;
+#     endif
+
       if( npts[0]>1 ) calculate_flux( *gradx, *interpx, temperature, thermCond, xflux );
       if( npts[1]>1 ) calculate_flux( *grady, *interpy, temperature, thermCond, yflux );
       if( npts[2]>1 ) calculate_flux( *gradz, *interpz, temperature, thermCond, zflux );
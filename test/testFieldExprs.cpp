@@ -69,10 +69,12 @@ bool test( const SS::IntVec dim )
   l2norm = sqrt(l2norm);
   status( field_equal_ulp(f4, f3, 1), "a+(a*b)-b/a" );
 
-  status( l2norm == field_norm(f4), "norm" );
+  // sums may group the points differently (SIMD lanes, thread partitions)
+  const double sum = std::accumulate(f4.begin(),f4.end(),0.0);
+  status( std::abs( l2norm - field_norm(f4) ) <= 1e-12 * l2norm, "norm" );
   status( *std::max_element(f4.begin(),f4.end()) == field_max(f4), "max" );
   status( *std::min_element(f4.begin(),f4.end()) == field_min(f4), "min" );
-  status( std::accumulate(f4.begin(),f4.end(),0.0) == field_sum(f4), "sum" );
+  status( std::abs( sum - field_sum(f4) ) <= 1e-12 * std::abs(sum), "sum" );
 
   return status.ok();
 }